@@ -1,6 +1,13 @@
 // FirstPersonRPGCharacter.cpp
 
 #include "FirstPersonRPGCharacter.h"
+#include "Combat/CombatantComponent.h"
+#include "Core/GridTypes.h"
+#include "Dungeon/DungeonStreamingSubsystem.h"
+#include "Dungeon/AutomapSubsystem.h"
+#include "Encounters/RoamingEncounterSubsystem.h"
+#include "Interaction/InteractionSubsystem.h"
+#include "Interaction/GridInteractable.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -22,6 +29,9 @@ AFirstPersonRPGCharacter::AFirstPersonRPGCharacter()
 	FirstPersonCamera->SetRelativeLocation(FVector(0.0f, 0.0f, 64.0f)); // Altura dos olhos
 	FirstPersonCamera->bUsePawnControlRotation = false; // Câmera segue o Pawn, não o Controller
 
+	// Stats de combate
+	Combatant = CreateDefaultSubobject<UCombatantComponent>(TEXT("Combatant"));
+
 	// Configurar movimento
 	GetCharacterMovement()->bOrientRotationToMovement = false;
 	GetCharacterMovement()->bUseControllerDesiredRotation = false;
@@ -52,6 +62,24 @@ void AFirstPersonRPGCharacter::BeginPlay()
 	SnapToGrid();
 	CurrentGridPosition = GetActorLocation();
 
+	// Streaming de chunks segue os passos deste personagem
+	if (UDungeonStreamingSubsystem* Streaming = GetWorld()->GetSubsystem<UDungeonStreamingSubsystem>())
+	{
+		Streaming->SetTrackedCharacter(this);
+	}
+
+	if (UAutomapSubsystem* Automap = GetGameInstance() ? GetGameInstance()->GetSubsystem<UAutomapSubsystem>() : nullptr)
+	{
+		Automap->SetTrackedCharacter(this);
+	}
+
+	if (URoamingEncounterSubsystem* Roaming = GetWorld()->GetSubsystem<URoamingEncounterSubsystem>())
+	{
+		Roaming->SetTrackedCharacter(this);
+	}
+
+	RefreshInteractionPrompt();
+
 	UE_LOG(LogTemp, Log, TEXT("FirstPersonRPGCharacter: Iniciado! Estilo de movimento: %s"), 
 		MovementStyle == EMovementStyle::GridBased ? TEXT("Grid Based") : TEXT("Free Movement"));
 }
@@ -236,6 +264,10 @@ void AFirstPersonRPGCharacter::ProcessGridMovement(float DeltaTime)
 		SetActorLocation(TargetGridPosition);
 		CurrentGridPosition = TargetGridPosition;
 		bIsMovingOnGrid = false;
+
+		// Sistemas de exploração reagem à nova célula uma vez por passo
+		OnGridCellEntered.Broadcast(this, GetCurrentGridCell());
+		RefreshInteractionPrompt();
 		
 		// Notificar que um passo foi dado (para random encounters)
 		CurrentStepCount++;
@@ -272,6 +304,7 @@ void AFirstPersonRPGCharacter::ProcessGridRotation(float DeltaTime)
 		SetActorRotation(TargetGridRotation);
 		
 		bIsRotatingOnGrid = false;
+		RefreshInteractionPrompt();
 	}
 	else
 	{
@@ -341,6 +374,34 @@ bool AFirstPersonRPGCharacter::CanMoveToPosition(const FVector& TargetPosition)
 	return !bHit;
 }
 
+FIntPoint AFirstPersonRPGCharacter::GetCurrentGridCell() const
+{
+	return FGridMath::WorldToCell(CurrentGridPosition, GridCellSize);
+}
+
+FIntPoint AFirstPersonRPGCharacter::GetFacingGridCell() const
+{
+	return GetCurrentGridCell() + FGridMath::YawToCellStep(GetActorRotation().Yaw);
+}
+
+void AFirstPersonRPGCharacter::RefreshInteractionPrompt()
+{
+	const UInteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UInteractionSubsystem>();
+	AActor* Target = Interaction ? Interaction->FindInteractableAt(GetFacingGridCell()) : nullptr;
+
+	const bool bNewCanInteract = Target && IGridInteractable::Execute_CanInteract(Target, this);
+	const FText NewPrompt = bNewCanInteract ? IGridInteractable::Execute_GetInteractionPrompt(Target) : FText::GetEmpty();
+
+	FacingInteractable = bNewCanInteract ? Target : nullptr;
+
+	if (bNewCanInteract != bCanInteract || !NewPrompt.IdenticalTo(InteractionPrompt))
+	{
+		bCanInteract = bNewCanInteract;
+		InteractionPrompt = NewPrompt;
+		OnInteractionPromptChanged(bCanInteract, InteractionPrompt);
+	}
+}
+
 void AFirstPersonRPGCharacter::SnapToGrid()
 {
 	FVector CurrentPos = GetActorLocation();
@@ -363,27 +424,15 @@ void AFirstPersonRPGCharacter::OnStepTaken_Implementation()
 
 void AFirstPersonRPGCharacter::Interact_Implementation()
 {
-	// Fazer line trace para frente e verificar interação
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-	
-	FVector StartPos = FirstPersonCamera->GetComponentLocation();
-	FVector EndPos = StartPos + (FirstPersonCamera->GetForwardVector() * 200.0f);
-	
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		StartPos,
-		EndPos,
-		ECC_Visibility,
-		QueryParams
-	);
-	
-	if (bHit && HitResult.GetActor())
+	// O alvo já foi resolvido ao terminar o último passo/giro
+	if (AActor* Target = FacingInteractable.Get())
 	{
-		UE_LOG(LogTemp, Log, TEXT("FirstPersonRPGCharacter: Interagindo com %s"), *HitResult.GetActor()->GetName());
-		// TODO: Chamar interface de interação no ator
+		UE_LOG(LogTemp, Log, TEXT("FirstPersonRPGCharacter: Interagindo com %s"), *Target->GetName());
+		IGridInteractable::Execute_Interact(Target, this);
 	}
+
+	// A interação pode ter mudado o estado do alvo (baú aberto, porta destrancada...)
+	RefreshInteractionPrompt();
 }
 
 void AFirstPersonRPGCharacter::OpenMenu_Implementation()
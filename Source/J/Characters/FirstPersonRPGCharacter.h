@@ -12,6 +12,11 @@ class UInputMappingContext;
 class UInputAction;
 class UCameraComponent;
 class USpringArmComponent;
+class UCombatantComponent;
+class AFirstPersonRPGCharacter;
+
+/** Disparado quando o personagem termina um passo e entra em uma nova célula (nativo) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGridCellEnteredNative, AFirstPersonRPGCharacter* /*Character*/, FIntPoint /*Cell*/);
 
 /**
  * Enum para o tipo de movimento do personagem
@@ -61,6 +66,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
 	UCameraComponent* FirstPersonCamera;
 
+	/** Stats e afinidades deste membro da party */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combat")
+	UCombatantComponent* Combatant;
+
 	// ==================== INPUT ACTIONS ====================
 	
 	/** Input Mapping Context */
@@ -140,6 +149,31 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Movement")
 	FVector GetCurrentGridPosition() const { return CurrentGridPosition; }
 
+	/** Célula inteira atual no grid */
+	UFUNCTION(BlueprintPure, Category = "Movement")
+	FIntPoint GetCurrentGridCell() const;
+
+	/** Célula à frente do personagem */
+	UFUNCTION(BlueprintPure, Category = "Movement")
+	FIntPoint GetFacingGridCell() const;
+
+	/** Notificação por célula para sistemas de exploração (streaming, zonas, automapa...) */
+	FOnGridCellEnteredNative OnGridCellEntered;
+
+	// ==================== INTERAÇÃO ====================
+
+	/** Há algo interagível à frente? (recalculado ao terminar cada passo/giro) */
+	UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+	bool bCanInteract = false;
+
+	/** Prompt do interagível à frente */
+	UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+	FText InteractionPrompt;
+
+	/** Chamado quando o prompt de interação muda (mostrar/esconder no HUD) */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Interaction")
+	void OnInteractionPromptChanged(bool bInCanInteract, const FText& Prompt);
+
 	/** Chamado quando um passo é dado (para random encounters) */
 	UFUNCTION(BlueprintNativeEvent, Category = "Encounters")
 	void OnStepTaken();
@@ -177,6 +211,9 @@ protected:
 	/** Alinha a posição atual ao grid mais próximo */
 	void SnapToGrid();
 
+	/** Consulta o interagível da célula à frente e atualiza o prompt */
+	void RefreshInteractionPrompt();
+
 private:
 	// Estado do movimento em grid
 	bool bIsMovingOnGrid = false;
@@ -190,4 +227,7 @@ private:
 	// Posição e rotação iniciais para interpolação
 	FVector StartGridPosition;
 	FRotator StartGridRotation;
+
+	/** Interagível da célula à frente (precomputado) */
+	TWeakObjectPtr<AActor> FacingInteractable;
 };
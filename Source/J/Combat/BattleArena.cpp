@@ -0,0 +1,121 @@
+// BattleArena.cpp
+
+#include "BattleArena.h"
+#include <atomic>
+
+namespace
+{
+	std::atomic<int32> GBattleArenaFallbackAllocations{0};
+}
+
+FBattleArena::FBattleArena(SIZE_T InBlockSize)
+	: BlockSize(InBlockSize)
+{
+}
+
+FBattleArena::~FBattleArena()
+{
+	checkf(GetCurrent() != this, TEXT("FBattleArena destruído enquanto ativo"));
+
+	for (const FBlock& Block : Blocks)
+	{
+		FMemory::Free(Block.Data);
+	}
+}
+
+void* FBattleArena::Allocate(SIZE_T Size, uint32 Alignment)
+{
+	// Procurar espaço no bloco atual e nos já existentes (reaproveitados após Reset)
+	while (CurrentBlock < Blocks.Num())
+	{
+		const FBlock& Block = Blocks[CurrentBlock];
+		const SIZE_T Aligned = Align(Offset, Alignment);
+		if (Aligned + Size <= Block.Size)
+		{
+			Stats.BytesUsed += (Aligned - Offset) + Size;
+			Stats.PeakBytes = FMath::Max(Stats.PeakBytes, Stats.BytesUsed);
+			Stats.NumAllocations++;
+			Offset = Aligned + Size;
+			LastAllocation = Block.Data + Aligned;
+			return LastAllocation;
+		}
+
+		CurrentBlock++;
+		Offset = 0;
+	}
+
+	// Sem espaço: um bloco novo no heap (só acontece enquanto o arena "aquece")
+	FBlock& Block = Blocks.AddDefaulted_GetRef();
+	Block.Size = FMath::Max(BlockSize, Size + Alignment);
+	Block.Data = (uint8*)FMemory::Malloc(Block.Size, FMath::Max<uint32>(Alignment, 16));
+	Stats.NumHeapBlocks++;
+	CurrentBlock = Blocks.Num() - 1;
+	Offset = 0;
+
+	return Allocate(Size, Alignment);
+}
+
+bool FBattleArena::TryGrowInPlace(void* Ptr, SIZE_T OldSize, SIZE_T NewSize)
+{
+	if (Ptr != LastAllocation || !Blocks.IsValidIndex(CurrentBlock))
+	{
+		return false;
+	}
+
+	// Ptr é a última alocação do bloco atual: basta avançar o offset
+	const FBlock& Block = Blocks[CurrentBlock];
+	const SIZE_T Start = (uint8*)Ptr - Block.Data;
+	if (Start + NewSize > Block.Size)
+	{
+		return false;
+	}
+
+	if (Start + NewSize > Offset)
+	{
+		Stats.BytesUsed += Start + NewSize - Offset;
+		Stats.PeakBytes = FMath::Max(Stats.PeakBytes, Stats.BytesUsed);
+		Offset = Start + NewSize;
+	}
+	return true;
+}
+
+void FBattleArena::Reset()
+{
+	CurrentBlock = 0;
+	Offset = 0;
+	LastAllocation = nullptr;
+	Stats.NumAllocations = 0;
+	Stats.BytesUsed = 0;
+}
+
+int32 FBattleArena::GetNumFallbackAllocations()
+{
+	return GBattleArenaFallbackAllocations.load(std::memory_order_relaxed);
+}
+
+void FBattleArena::NoteFallbackAllocation()
+{
+	GBattleArenaFallbackAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+FBattleArena*& FBattleArena::CurrentArena()
+{
+	static thread_local FBattleArena* Current = nullptr;
+	return Current;
+}
+
+FBattleArena* FBattleArena::GetCurrent()
+{
+	return CurrentArena();
+}
+
+FBattleArena::FScope::FScope(FBattleArena& Arena)
+	: Previous(CurrentArena())
+{
+	CurrentArena() = &Arena;
+}
+
+FBattleArena::FScope::~FScope()
+{
+	CurrentArena() = Previous;
+}
@@ -0,0 +1,274 @@
+// BattleArena.h
+// Alocador linear com escopo de uma batalha
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * Contadores do arena
+ * Só cobrem os containers que usam FBattleArenaAllocator. O total real que o
+ * combate pede ao heap (spawn de atores, delegates, arrays UPROPERTY...)
+ * aparece na tag "Combat" do LLM (-llm, stat LLM).
+ */
+struct FBattleArenaStats
+{
+	/** Alocações servidas pelo arena desde o último Reset */
+	int32 NumAllocations = 0;
+
+	/** Blocos pedidos ao heap desde a criação do arena (estabiliza após a primeira batalha) */
+	int32 NumHeapBlocks = 0;
+
+	/** Bytes em uso desde o último Reset */
+	SIZE_T BytesUsed = 0;
+
+	/** Maior BytesUsed já visto */
+	SIZE_T PeakBytes = 0;
+};
+
+/**
+ * Arena linear da batalha
+ * Alocar só avança um ponteiro; nada é liberado individualmente. O
+ * ACombatManager chama Reset no EndCombat, que volta ao início sem devolver
+ * os blocos ao heap, então a partir da segunda batalha os containers do
+ * arena não pedem mais nada ao heap. Isso não vale para o combate inteiro:
+ * spawnar inimigos, inscrever delegates e copiar a party continuam no heap
+ * normal (medidos pela tag "Combat" do LLM).
+ *
+ * Os containers usam o arena via FBattleArenaAllocator, que pega o arena
+ * ativo (FBattleArena::FScope) na primeira alocação.
+ */
+class J_API FBattleArena
+{
+public:
+	explicit FBattleArena(SIZE_T InBlockSize = 64 * 1024);
+	~FBattleArena();
+
+	FBattleArena(const FBattleArena&) = delete;
+	FBattleArena& operator=(const FBattleArena&) = delete;
+
+	void* Allocate(SIZE_T Size, uint32 Alignment);
+
+	/** Cresce a última alocação sem mover, se couber no bloco atual */
+	bool TryGrowInPlace(void* Ptr, SIZE_T OldSize, SIZE_T NewSize);
+
+	/** Volta ao início mantendo os blocos (toda memória entregue fica inválida) */
+	void Reset();
+
+	const FBattleArenaStats& GetStats() const { return Stats; }
+
+	/** Alocações de FBattleArenaAllocator feitas sem arena ativo (foram para o heap) */
+	static int32 GetNumFallbackAllocations();
+	static void NoteFallbackAllocation();
+
+	/** Arena ativo na thread atual (nullptr = nenhum) */
+	static FBattleArena* GetCurrent();
+
+	/** Ativa um arena enquanto existir */
+	class J_API FScope
+	{
+	public:
+		explicit FScope(FBattleArena& Arena);
+		~FScope();
+
+	private:
+		FBattleArena* Previous;
+	};
+
+private:
+	struct FBlock
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+	};
+
+	static FBattleArena*& CurrentArena();
+
+	TArray<FBlock, TInlineAllocator<8>> Blocks;
+	int32 CurrentBlock = 0;
+	SIZE_T Offset = 0;
+	uint8* LastAllocation = nullptr;
+	SIZE_T BlockSize;
+	FBattleArenaStats Stats;
+};
+
+/**
+ * Alocador de TArray sobre o FBattleArena ativo
+ * Crescer copia para um novo trecho do arena (ou estende no lugar se for a
+ * última alocação); encolher/liberar não devolve nada. Sem arena ativo, cai
+ * no heap e é contado em FBattleArena::GetNumFallbackAllocations.
+ *
+ * Containers com este alocador precisam ser esvaziados (Empty) antes do
+ * FBattleArena::Reset; não podem ser UPROPERTY.
+ */
+class FBattleArenaAllocator
+{
+public:
+	using SizeType = int32;
+
+	enum { NeedsElementType = false };
+	enum { RequireRangeCheck = true };
+
+	class ForAnyElementType
+	{
+	public:
+		ForAnyElementType() = default;
+
+		ForAnyElementType(const ForAnyElementType&) = delete;
+		ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+		~ForAnyElementType()
+		{
+			if (Data && !Arena)
+			{
+				FMemory::Free(Data);
+			}
+		}
+
+		void MoveToEmpty(ForAnyElementType& Other)
+		{
+			check(this != &Other);
+			if (Data && !Arena)
+			{
+				FMemory::Free(Data);
+			}
+
+			Data = Other.Data;
+			Arena = Other.Arena;
+			Other.Data = nullptr;
+			Other.Arena = nullptr;
+		}
+
+		FORCEINLINE FScriptContainerElement* GetAllocation() const
+		{
+			return Data;
+		}
+
+		void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement)
+		{
+			ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement, DEFAULT_ALIGNMENT);
+		}
+
+		void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement)
+		{
+			if (NewMax == 0)
+			{
+				// No arena nada é devolvido; só esquecemos o trecho
+				if (Data && !Arena)
+				{
+					FMemory::Free(Data);
+				}
+				Data = nullptr;
+				Arena = nullptr;
+				return;
+			}
+
+			const SIZE_T NewSize = (SIZE_T)NewMax * NumBytesPerElement;
+			const uint32 Alignment = FMath::Max<uint32>(AlignmentOfElement, alignof(void*));
+
+			if (!Data)
+			{
+				Arena = FBattleArena::GetCurrent();
+			}
+
+			if (!Arena)
+			{
+				FBattleArena::NoteFallbackAllocation();
+				Data = (FScriptContainerElement*)FMemory::Realloc(Data, NewSize, Alignment);
+				return;
+			}
+
+			const SIZE_T UsedSize = (SIZE_T)CurrentNum * NumBytesPerElement;
+			if (Data && Arena->TryGrowInPlace(Data, UsedSize, NewSize))
+			{
+				return;
+			}
+
+			void* NewData = Arena->Allocate(NewSize, Alignment);
+			if (Data && UsedSize > 0)
+			{
+				FMemory::Memcpy(NewData, Data, FMath::Min(UsedSize, NewSize));
+			}
+			Data = (FScriptContainerElement*)NewData;
+		}
+
+		SizeType CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement) const
+		{
+			return NewMax;
+		}
+
+		SizeType CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement) const
+		{
+			return NewMax;
+		}
+
+		SizeType CalculateSlackShrink(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+		{
+			// Encolher não libera nada no arena
+			return Arena ? CurrentMax : DefaultCalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement, false);
+		}
+
+		SizeType CalculateSlackShrink(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement) const
+		{
+			return Arena ? CurrentMax : DefaultCalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement, false, AlignmentOfElement);
+		}
+
+		SizeType CalculateSlackGrow(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false);
+		}
+
+		SizeType CalculateSlackGrow(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement) const
+		{
+			return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false, AlignmentOfElement);
+		}
+
+		SIZE_T GetAllocatedSize(SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+		{
+			return (SIZE_T)CurrentMax * NumBytesPerElement;
+		}
+
+		bool HasAllocation() const
+		{
+			return !!Data;
+		}
+
+		SizeType GetInitialCapacity() const
+		{
+			return 0;
+		}
+
+	private:
+		FScriptContainerElement* Data = nullptr;
+
+		/** Arena dono de Data (nullptr com Data != nullptr = heap) */
+		FBattleArena* Arena = nullptr;
+	};
+
+	template<typename ElementType>
+	class ForElementType : public ForAnyElementType
+	{
+	public:
+		ForElementType() = default;
+
+		FORCEINLINE ElementType* GetAllocation() const
+		{
+			return (ElementType*)ForAnyElementType::GetAllocation();
+		}
+	};
+};
+
+template <>
+struct TAllocatorTraits<FBattleArenaAllocator> : TAllocatorTraitsBase<FBattleArenaAllocator>
+{
+	enum { IsZeroConstruct = true };
+	enum { SupportsElementAlignment = true };
+};
+
+/** Array de índices transitório da batalha */
+using FBattleIndexArray = TArray<int32, FBattleArenaAllocator>;
+
+/** Lista de alvos de uma ação: 8 inline, o excedente vai para o arena ativo (não para o heap) */
+using FBattleTargetArray = TArray<AActor*, TInlineAllocator<8, FBattleArenaAllocator>>;
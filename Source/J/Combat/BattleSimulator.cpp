@@ -0,0 +1,312 @@
+// BattleSimulator.cpp
+
+#include "BattleSimulator.h"
+#include "EnemyDatabase.h"
+#include "DamageFormulas.h"
+#include "BattleArena.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+namespace
+{
+	/** Estado de um combatente durante a simulação */
+	struct FSimCombatant
+	{
+		int32 HP = 0;
+		int32 MaxHP = 1;
+		int32 MP = 0;
+		int32 Strength = 0;
+		int32 Magic = 0;
+		int32 Vitality = 0;
+		int32 Agility = 0;
+		int32 Luck = 0;
+		uint32 PackedAffinities = 0;
+		uint16 FirstSkill = 0;
+		uint16 NumSkills = 0;
+		bool bPlayerSide = false;
+
+		bool IsAlive() const { return HP > 0; }
+	};
+
+	/** Contexto exclusivo de um worker */
+	struct FSimWorker
+	{
+		FRandomStream Random;
+		FBattleArena Arena { 16 * 1024 };
+		FBattleSimStats Stats;
+	};
+
+	/** Mesmo ataque básico de ACombatManager::MakeBasicAttack */
+	FEnemySkillRecord MakeBasicAttackRecord()
+	{
+		FEnemySkillRecord Attack;
+		Attack.BasePower = 30;
+		Attack.AccuracyPermille = 900;
+		Attack.EffectType = (uint8)ESkillEffectType::Damage;
+		Attack.Element = (uint8)ERPGElement::Physical;
+		return Attack;
+	}
+
+	FSimCombatant MakeCombatant(const FEnemyRecord& Record, bool bPlayerSide)
+	{
+		FSimCombatant Unit;
+		Unit.HP = Record.MaxHP;
+		Unit.MaxHP = FMath::Max(1, Record.MaxHP);
+		Unit.MP = Record.MaxMP;
+		Unit.Strength = Record.Strength;
+		Unit.Magic = Record.Magic;
+		Unit.Vitality = Record.Vitality;
+		Unit.Agility = Record.Agility;
+		Unit.Luck = Record.Luck;
+		Unit.PackedAffinities = Record.PackedAffinities;
+		Unit.FirstSkill = Record.FirstSkill;
+		Unit.NumSkills = Record.NumSkills;
+		Unit.bPlayerSide = bPlayerSide;
+		return Unit;
+	}
+
+	template<typename TFormula>
+	void SimulateBattle(const FEnemyDatabase& Database, const FBattleSimConfig& Config, const FEnemySkillRecord& BasicAttack, FSimWorker& Worker)
+	{
+		FBattleArena::FScope ArenaScope(Worker.Arena);
+		const FRandomStream& Random = Worker.Random;
+
+		TArray<FSimCombatant, FBattleArenaAllocator> Units;
+		Units.Reserve(Config.Party.Num() + Config.Enemies.Num());
+		for (int32 Index : Config.Party)
+		{
+			Units.Add(MakeCombatant(Database.GetRecord(Index), true));
+		}
+		for (int32 Index : Config.Enemies)
+		{
+			const FEnemyRecord& Record = Database.GetRecord(Index);
+			Units.Add(MakeCombatant(Config.EnemyStatPermille != FCombatMath::One
+				? FBattleSimulator::ScaleEnemyRecord(Record, Config.EnemyStatPermille) : Record, false));
+		}
+
+		// Mesma ordem de turnos do ACombatManager (party antes dos inimigos nos índices)
+		FBattleIndexArray Order;
+		FCombatMath::BuildTurnOrder(Order, Units.Num(), [&Units](int32 Index) { return Units[Index].Agility; });
+
+		int32 AlivePlayers = Config.Party.Num();
+		int32 AliveEnemies = Config.Enemies.Num();
+		int32 Round = 0;
+
+		while (AlivePlayers > 0 && AliveEnemies > 0 && Round < Config.MaxRounds)
+		{
+			Round++;
+
+			for (int32 ActorIndex : Order)
+			{
+				FSimCombatant& Actor = Units[ActorIndex];
+				if (!Actor.IsAlive())
+				{
+					continue;
+				}
+
+				const int32 NumTargets = Actor.bPlayerSide ? AliveEnemies : AlivePlayers;
+				if (NumTargets == 0)
+				{
+					break;
+				}
+
+				// Alvo aleatório vivo do outro lado
+				int32 Remaining = FCombatMath::RandRange(Random, 0, NumTargets - 1);
+				int32 TargetIndex = INDEX_NONE;
+				for (int32 i = 0; i < Units.Num(); i++)
+				{
+					if (Units[i].bPlayerSide != Actor.bPlayerSide && Units[i].IsAlive() && Remaining-- == 0)
+					{
+						TargetIndex = i;
+						break;
+					}
+				}
+				FSimCombatant& Target = Units[TargetIndex];
+
+				// Skill de dano aleatória entre as que tem MP, senão ataque básico
+				const TConstArrayView<uint16> SkillIndices = Database.GetSkillIndices(Actor.FirstSkill, Actor.NumSkills);
+				int32 NumUsable = 0;
+				for (uint16 SkillIndex : SkillIndices)
+				{
+					const FEnemySkillRecord& Skill = Database.GetSkill(SkillIndex);
+					NumUsable += Skill.EffectType == (uint8)ESkillEffectType::Damage && Skill.BasePower > 0 && Actor.MP >= Skill.MPCost ? 1 : 0;
+				}
+
+				const FEnemySkillRecord* Skill = &BasicAttack;
+				if (NumUsable > 0)
+				{
+					int32 Pick = FCombatMath::RandRange(Random, 0, NumUsable - 1);
+					for (uint16 SkillIndex : SkillIndices)
+					{
+						const FEnemySkillRecord& Candidate = Database.GetSkill(SkillIndex);
+						if (Candidate.EffectType == (uint8)ESkillEffectType::Damage && Candidate.BasePower > 0 && Actor.MP >= Candidate.MPCost && Pick-- == 0)
+						{
+							Skill = &Candidate;
+							break;
+						}
+					}
+				}
+				Actor.MP -= Skill->MPCost;
+
+				const ERPGElement Element = (ERPGElement)Skill->Element;
+				const bool bPhysical = Element == ERPGElement::Physical;
+
+				FDamageInput Input;
+				Input.Power = Skill->BasePower;
+				Input.AccuracyPermille = Skill->AccuracyPermille;
+				Input.AttackStat = bPhysical ? Actor.Strength : Actor.Magic;
+				Input.DefenseStat = bPhysical ? Target.Vitality : Target.Magic;
+				Input.AttackerAgility = Actor.Agility;
+				Input.DefenderAgility = Target.Agility;
+				Input.AttackerLuck = Actor.Luck;
+				Input.DefenderLuck = Target.Luck;
+				Input.AttackerAffinity = FEnemyDatabase::UnpackAffinity(Actor.PackedAffinities, Element);
+				Input.DefenderAffinity = FEnemyDatabase::UnpackAffinity(Target.PackedAffinities, Element);
+
+				const FDamageOutcome Outcome = FDamageFormulas::Resolve<TFormula>(Input, Random);
+				if (!Outcome.bHit || Outcome.Damage == 0)
+				{
+					continue;
+				}
+
+				FSimCombatant& Recipient = Outcome.bReflected ? Actor : Target;
+				if (Outcome.bHealed)
+				{
+					Recipient.HP = FMath::Min(Recipient.MaxHP, Recipient.HP + Outcome.Damage);
+					continue;
+				}
+
+				Recipient.HP = FMath::Max(0, Recipient.HP - Outcome.Damage);
+				Worker.Stats.TotalDamageDealt += Outcome.Damage;
+				if (!Recipient.IsAlive())
+				{
+					(Recipient.bPlayerSide ? AlivePlayers : AliveEnemies)--;
+				}
+
+				if (AlivePlayers == 0 || AliveEnemies == 0)
+				{
+					break;
+				}
+			}
+		}
+
+		// Resultado
+		FBattleSimStats& Stats = Worker.Stats;
+		Stats.NumBattles++;
+		Stats.TotalRounds += Round;
+		if (AliveEnemies == 0)
+		{
+			Stats.NumVictories++;
+		}
+		else if (AlivePlayers == 0)
+		{
+			Stats.NumDefeats++;
+		}
+		else
+		{
+			Stats.NumTimeouts++;
+		}
+
+		int64 PartyHP = 0;
+		int64 PartyMaxHP = 0;
+		for (const FSimCombatant& Unit : Units)
+		{
+			if (Unit.bPlayerSide)
+			{
+				PartyHP += Unit.HP;
+				PartyMaxHP += Unit.MaxHP;
+			}
+		}
+		Stats.TotalPartyHPPermille += PartyMaxHP > 0 ? PartyHP * FCombatMath::One / PartyMaxHP : 0;
+
+		// Soltar os trechos e voltar o arena ao início para a próxima batalha
+		Units.Empty();
+		Order.Empty();
+		Worker.Arena.Reset();
+	}
+}
+
+int32 FBattleSimulator::GetBattleSeed(int32 Seed, int64 BattleIndex)
+{
+	return (int32)HashCombine(GetTypeHash(Seed), GetTypeHash(BattleIndex));
+}
+
+FEnemyRecord FBattleSimulator::ScaleEnemyRecord(const FEnemyRecord& Record, int32 StatPermille)
+{
+	auto ScaleStat = [StatPermille](int16 Value) { return (int16)FMath::Clamp(FCombatMath::ApplyPermille(Value, StatPermille), 0, (int32)MAX_int16); };
+
+	FEnemyRecord Scaled = Record;
+	Scaled.MaxHP = FMath::Max(1, FCombatMath::ApplyPermille(Record.MaxHP, StatPermille));
+	Scaled.Strength = ScaleStat(Record.Strength);
+	Scaled.Magic = ScaleStat(Record.Magic);
+	Scaled.Vitality = ScaleStat(Record.Vitality);
+	Scaled.Agility = ScaleStat(Record.Agility);
+	Scaled.Luck = ScaleStat(Record.Luck);
+	return Scaled;
+}
+
+FBattleSimStats FBattleSimulator::Run(const FEnemyDatabase& Database, const FBattleSimConfig& Config, int64 NumBattles, int32 NumThreads, int32 Seed)
+{
+	FBattleSimStats Total;
+	if (NumBattles <= 0 || Config.Party.Num() == 0 || Config.Enemies.Num() == 0)
+	{
+		return Total;
+	}
+
+	const int64 NumBatches = (NumBattles + BattlesPerBatch - 1) / BattlesPerBatch;
+	NumThreads = NumThreads > 0 ? NumThreads : FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	NumThreads = (int32)FMath::Clamp<int64>(NumThreads, 1, NumBatches);
+
+	// Um contexto por worker, cada um em sua própria alocação (sem false sharing nos acumuladores)
+	TArray<TUniquePtr<FSimWorker>> Workers;
+	for (int32 i = 0; i < NumThreads; i++)
+	{
+		Workers.Add(MakeUnique<FSimWorker>());
+	}
+
+	const FEnemySkillRecord BasicAttack = MakeBasicAttackRecord();
+	std::atomic<int64> NextBatch { 0 };
+
+	// Política escolhida uma vez; o laço dos workers é a instanciação dela
+	FDamageFormulas::Dispatch(Config.Formula, [&](auto Policy)
+	{
+		using TFormula = decltype(Policy);
+
+		auto WorkerBody = [&](FSimWorker& Worker)
+		{
+			for (;;)
+			{
+				const int64 Batch = NextBatch.fetch_add(1, std::memory_order_relaxed);
+				if (Batch >= NumBatches)
+				{
+					break;
+				}
+
+				const int64 First = Batch * BattlesPerBatch;
+				const int64 Last = FMath::Min(First + BattlesPerBatch, NumBattles);
+				for (int64 BattleIndex = First; BattleIndex < Last; BattleIndex++)
+				{
+					Worker.Random.Initialize(GetBattleSeed(Seed, BattleIndex));
+					SimulateBattle<TFormula>(Database, Config, BasicAttack, Worker);
+				}
+			}
+		};
+
+		TArray<UE::Tasks::FTask> Tasks;
+		for (int32 i = 1; i < NumThreads; i++)
+		{
+			FSimWorker* Worker = Workers[i].Get();
+			Tasks.Add(UE::Tasks::Launch(TEXT("BattleSimulator"), [&WorkerBody, Worker]() { WorkerBody(*Worker); }));
+		}
+
+		// A thread chamadora também trabalha
+		WorkerBody(*Workers[0]);
+		UE::Tasks::Wait(Tasks);
+	});
+
+	for (const TUniquePtr<FSimWorker>& Worker : Workers)
+	{
+		Total.Merge(Worker->Stats);
+	}
+	return Total;
+}
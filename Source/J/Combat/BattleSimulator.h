@@ -0,0 +1,97 @@
+// BattleSimulator.h
+// Simulação em massa de batalhas sem atores, para balanceamento
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+
+class FEnemyDatabase;
+struct FEnemyRecord;
+
+/**
+ * Uma batalha a simular: lados como índices no FEnemyDatabase
+ */
+struct FBattleSimConfig
+{
+	/** Party (arquétipos do banco usados como membros) */
+	TArray<int32> Party;
+
+	/** Inimigos */
+	TArray<int32> Enemies;
+
+	EDamageFormula Formula = EDamageFormula::Classic;
+
+	/** Rodadas até declarar empate */
+	int32 MaxRounds = 100;
+
+	/** Escala de HP e stats dos inimigos em permilagem (1000 = arquétipo original) */
+	int32 EnemyStatPermille = 1000;
+};
+
+/**
+ * Totais de um lote de batalhas (somáveis, mesclados no fim)
+ */
+struct FBattleSimStats
+{
+	int64 NumBattles = 0;
+	int64 NumVictories = 0;
+	int64 NumDefeats = 0;
+	int64 NumTimeouts = 0;
+	int64 TotalRounds = 0;
+
+	/** Soma do HP restante da party, em permilagem do HP máximo somado */
+	int64 TotalPartyHPPermille = 0;
+
+	int64 TotalDamageDealt = 0;
+
+	void Merge(const FBattleSimStats& Other)
+	{
+		NumBattles += Other.NumBattles;
+		NumVictories += Other.NumVictories;
+		NumDefeats += Other.NumDefeats;
+		NumTimeouts += Other.NumTimeouts;
+		TotalRounds += Other.TotalRounds;
+		TotalPartyHPPermille += Other.TotalPartyHPPermille;
+		TotalDamageDealt += Other.TotalDamageDealt;
+	}
+
+	bool operator==(const FBattleSimStats& Other) const
+	{
+		return NumBattles == Other.NumBattles && NumVictories == Other.NumVictories && NumDefeats == Other.NumDefeats
+			&& NumTimeouts == Other.NumTimeouts && TotalRounds == Other.TotalRounds
+			&& TotalPartyHPPermille == Other.TotalPartyHPPermille && TotalDamageDealt == Other.TotalDamageDealt;
+	}
+
+	double GetWinRate() const { return NumBattles > 0 ? (double)NumVictories / NumBattles : 0.0; }
+	double GetAverageRounds() const { return NumBattles > 0 ? (double)TotalRounds / NumBattles : 0.0; }
+};
+
+/**
+ * Simulador de batalhas em massa
+ * Lê só o FEnemyDatabase (nada de UObject) e usa o mesmo pipeline inteiro de
+ * dano do ACombatManager (FDamageFormulas::Resolve), então o resultado de
+ * cada batalha depende apenas da seed.
+ *
+ * Run divide as batalhas em lotes puxados dinamicamente por NumThreads
+ * workers (UE::Tasks): quem termina antes pega o próximo lote, então a carga
+ * se equilibra sozinha. Cada worker tem RNG, FBattleArena e acumulador
+ * próprios; os acumuladores só são somados no fim, sem locks. A seed de cada
+ * batalha vem do seu índice, então os totais são idênticos com qualquer
+ * número de threads.
+ */
+class J_API FBattleSimulator
+{
+public:
+	/** Batalhas por lote puxado de uma vez por um worker */
+	static constexpr int32 BattlesPerBatch = 256;
+
+	/** Simula NumBattles batalhas; NumThreads <= 0 usa todos os núcleos */
+	static FBattleSimStats Run(const FEnemyDatabase& Database, const FBattleSimConfig& Config, int64 NumBattles, int32 NumThreads, int32 Seed);
+
+	/** Seed da batalha BattleIndex */
+	static int32 GetBattleSeed(int32 Seed, int64 BattleIndex);
+
+	/** HP e stats de combate escalados (MP, nível e recompensas ficam como estão) */
+	static FEnemyRecord ScaleEnemyRecord(const FEnemyRecord& Record, int32 StatPermille);
+};
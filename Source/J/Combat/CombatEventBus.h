@@ -0,0 +1,48 @@
+// CombatEventBus.h
+// Barramento de eventos nativo (não-dinâmico) do combate
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+
+enum class ECombatState : uint8;
+enum class ENegotiationOutcome : uint8;
+struct FAttackResult;
+
+// Delegates nativos: chamada direta, sem reflexão nem ProcessEvent
+DECLARE_MULTICAST_DELEGATE(FOnCombatStartedNative);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCombatEndedNative, ECombatState /*EndState*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTurnChangedNative, bool /*bIsPlayerTurn*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnDamageDealtNative, AActor* /*Target*/, const FAttackResult& /*Result*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnNegotiationEndedNative, AActor* /*Demon*/, ENegotiationOutcome /*Outcome*/);
+
+/**
+ * Eventos de combate para assinantes em C++ (simulador, analytics, replay...)
+ * Os delegates dinâmicos do ACombatManager continuam existindo para Blueprint,
+ * mas só são disparados quando há algo ligado a eles.
+ */
+struct FCombatEventBus
+{
+	FOnCombatStartedNative OnCombatStarted;
+	FOnCombatEndedNative OnCombatEnded;
+	FOnTurnChangedNative OnTurnChanged;
+	FOnDamageDealtNative OnDamageDealt;
+
+	/** HP/MP de um participante mudou */
+	FOnRPGStatsChanged OnParticipantStatsChanged;
+
+	/** Uma negociação (Talk) terminou */
+	FOnNegotiationEndedNative OnNegotiationEnded;
+
+	/** Remove todos os assinantes ligados a um objeto */
+	void RemoveAll(const void* UserObject)
+	{
+		OnCombatStarted.RemoveAll(UserObject);
+		OnCombatEnded.RemoveAll(UserObject);
+		OnTurnChanged.RemoveAll(UserObject);
+		OnDamageDealt.RemoveAll(UserObject);
+		OnParticipantStatsChanged.RemoveAll(UserObject);
+		OnNegotiationEnded.RemoveAll(UserObject);
+	}
+};
@@ -1,11 +1,22 @@
 // CombatManager.cpp
 
 #include "CombatManager.h"
+#include "EnemyBase.h"
+#include "CombatantComponent.h"
+#include "Core/JGameInstance.h"
+#include "Negotiation/NegotiationGraphAsset.h"
+#include "Compendium/DemonCompendiumSubsystem.h"
+#include "Items/InventorySubsystem.h"
+#include "ProgressionSystem.h"
+#include "CombatMath.h"
+#include "DamageFormulas.h"
 #include "Kismet/GameplayStatics.h"
+#include "HAL/LowLevelMemTracker.h"
 
 ACombatManager::ACombatManager()
 {
 	PrimaryActorTick.bCanEverTick = false;
+	SelectDamageFormula();
 }
 
 void ACombatManager::BeginPlay()
@@ -23,36 +34,128 @@ void ACombatManager::StartCombat(const TArray<AActor*>& InPlayerParty, const TAr
 		return;
 	}
 
+	LLM_SCOPE_BYNAME(TEXT("Combat"));
+	FBattleArena::FScope ArenaScope(Arena);
+
 	PlayerParty = InPlayerParty;
 	Enemies = InEnemies;
 	CurrentTurn = 0;
 	ActiveParticipantIndex = 0;
+	LastBattleRewards = FBattleRewards();
+	BattleRandom.Initialize(BattleSeed != 0 ? BattleSeed : FMath::Rand());
+	SelectDamageFormula();
 
 	UE_LOG(LogTemp, Log, TEXT("CombatManager: Combate iniciado! %d jogadores vs %d inimigos"), 
 		PlayerParty.Num(), Enemies.Num());
 
+	// Guardar os combatentes uma única vez; a partir daqui toda leitura de stats é direta
+	CacheParticipantCombatants();
+	StatusEffects.Initialize(ParticipantCombatants.Num());
+
 	// Determinar ordem de turnos
 	DetermineTurnOrder();
 
+	// Escutar mudanças de stats e enviar o estado inicial de todos para a UI
+	BindParticipantStatEvents();
+	DirtyParticipants.Init(true, PlayerParty.Num() + Enemies.Num());
+	DepartedParticipants.Init(false, PlayerParty.Num() + Enemies.Num());
+
 	// Iniciar combate
 	CurrentState = ECombatState::Initializing;
-	OnCombatStarted.Broadcast();
+	BroadcastCombatStarted();
 
 	// Primeiro turno
 	NextTurn();
 }
 
+void ACombatManager::StartEncounter(const TArray<AActor*>& InPlayerParty, const FEncounterData& Encounter, const FEncounterSpawnDescriptor& Spawn, const FTransform& ArenaOrigin)
+{
+	if (IsCombatActive())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CombatManager: Combate já está ativo!"));
+		return;
+	}
+
+	const FEncounterFormation* Formation = Encounter.Formations.IsValidIndex(Spawn.FormationIndex) ? &Encounter.Formations[Spawn.FormationIndex] : nullptr;
+
+	SpawnedEnemies.Reset(Spawn.Num());
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 i = 0; i < Spawn.Num(); i++)
+	{
+		const int32 Slot = Spawn.SlotIndices[i];
+
+		// Sem formação: em linha, centrada na origem
+		const FVector2D Offset = Formation && Formation->Slots.IsValidIndex(Slot)
+			? Formation->Slots[Slot]
+			: FVector2D(0.0f, (Slot - (Spawn.Num() - 1) * 0.5f) * DefaultEnemySpacing);
+
+		const FVector Location = ArenaOrigin.TransformPosition(FVector(Offset.X, Offset.Y, 0.0f));
+		const FRotator Rotation = ArenaOrigin.Rotator();
+
+		if (AEnemyBase* Enemy = GetWorld()->SpawnActor<AEnemyBase>(Encounter.GetEnemyClass(Spawn.EnemyIndices[i]), Location, Rotation, SpawnParams))
+		{
+			SpawnedEnemies.Add(Enemy);
+		}
+	}
+
+	if (SpawnedEnemies.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CombatManager: Encontro %s sem inimigos válidos"), *Encounter.EncounterID.ToString());
+		return;
+	}
+
+	StartCombat(InPlayerParty, SpawnedEnemies);
+}
+
 void ACombatManager::EndCombat(ECombatState EndState)
 {
 	UE_LOG(LogTemp, Log, TEXT("CombatManager: Combate terminado! Estado: %d"), (int32)EndState);
 
 	CurrentState = EndState;
-	OnCombatEnded.Broadcast(EndState);
 
-	// Limpar
-	PlayerParty.Empty();
-	Enemies.Empty();
+	// Recompensas antes do evento, para a tela de vitória já poder lê-las
+	if (EndState == ECombatState::Victory)
+	{
+		DistributeRewards();
+	}
+
+	// Ouvintes de OnCombatEnded ainda podem consumir as marcas pendentes (ex.: HP do golpe final)
+	BroadcastCombatEnded(EndState);
+
+	// Limpar (Reset mantém a memória para a próxima batalha)
+	UnbindParticipantStatEvents();
+	DirtyParticipants.Reset();
+	DepartedParticipants.Reset();
+	NegotiationTarget = nullptr;
+	Negotiation = FNegotiationSession();
+	ParticipantCombatants.Reset();
+	StatusEffects.Reset();
+	PlayerParty.Reset();
+	Enemies.Reset();
+
+	// Inimigos do encontro não sobrevivem à batalha (nem os que fugiram ou foram recrutados)
+	for (AActor* Enemy : SpawnedEnemies)
+	{
+		if (IsValid(Enemy))
+		{
+			Enemy->Destroy();
+		}
+	}
+	SpawnedEnemies.Reset();
+
+	// Containers do arena precisam soltar seus trechos antes do Reset
 	TurnOrder.Empty();
+	PoisonedParticipants.Empty();
+
+	const FBattleArenaStats& ArenaStats = Arena.GetStats();
+	UE_LOG(LogTemp, Log, TEXT("CombatManager: Arena: %d alocações, %llu bytes (pico %llu), %d blocos do heap, %d alocações fora do arena"),
+		ArenaStats.NumAllocations, (uint64)ArenaStats.BytesUsed, (uint64)ArenaStats.PeakBytes,
+		ArenaStats.NumHeapBlocks, FBattleArena::GetNumFallbackAllocations());
+	Arena.Reset();
+
 	CurrentTurn = 0;
 	ActiveParticipantIndex = 0;
 
@@ -60,6 +163,63 @@ void ACombatManager::EndCombat(ECombatState EndState)
 	CurrentState = ECombatState::Inactive;
 }
 
+void ACombatManager::DistributeRewards()
+{
+	UJGameInstance* GameInstance = Cast<UJGameInstance>(GetGameInstance());
+	UInventorySubsystem* Inventory = GameInstance ? GameInstance->GetSubsystem<UInventorySubsystem>() : nullptr;
+
+	// Só inimigos derrotados contam (recrutados/fugitivos não dão recompensa)
+	for (int32 i = 0; i < Enemies.Num(); i++)
+	{
+		const AEnemyBase* Enemy = Cast<AEnemyBase>(Enemies[i]);
+		if (!Enemy || DepartedParticipants[PlayerParty.Num() + i] || !Enemy->IsDead())
+		{
+			continue;
+		}
+
+		LastBattleRewards.Experience += Enemy->ExperienceReward;
+		LastBattleRewards.Gold += Enemy->GoldReward;
+
+		if (!Enemy->DropItem.IsNone() && FCombatMath::Chance(BattleRandom, FCombatMath::PercentToPermille(Enemy->ItemDropChance)))
+		{
+			LastBattleRewards.Items.Add(Enemy->DropItem);
+			if (Inventory)
+			{
+				Inventory->AddItem(Enemy->DropItem);
+			}
+		}
+	}
+
+	// EXP para cada membro vivo da party
+	for (int32 i = 0; i < PlayerParty.Num(); i++)
+	{
+		UCombatantComponent* Member = ParticipantCombatants[i];
+		if (Member && !Member->IsDead())
+		{
+			const int32 LevelsGained = Member->AddExperience(LastBattleRewards.Experience);
+			if (LevelsGained > 0)
+			{
+				UE_LOG(LogTemp, Log, TEXT("CombatManager: %s subiu para o nível %d!"), *PlayerParty[i]->GetName(), Member->GetStats().Level);
+			}
+		}
+	}
+
+	if (GameInstance)
+	{
+		GameInstance->PlayerGold += LastBattleRewards.Gold;
+
+		// EXP e nível vivem no componente; o GameInstance só espelha o líder da party para o save
+		if (const UCombatantComponent* Leader = ParticipantCombatants.IsValidIndex(0) && PlayerParty.Num() > 0 ? ParticipantCombatants[0] : nullptr)
+		{
+			GameInstance->PlayerExperience = Leader->Experience;
+			GameInstance->PlayerLevel = Leader->GetStats().Level;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("CombatManager: Vitória! %d EXP, %d gold, %d itens"),
+		LastBattleRewards.Experience, LastBattleRewards.Gold, LastBattleRewards.Items.Num());
+}
+
 void ACombatManager::NextTurn()
 {
 	if (!IsCombatActive() || CurrentState == ECombatState::Victory || CurrentState == ECombatState::Defeat)
@@ -67,23 +227,19 @@ void ACombatManager::NextTurn()
 		return;
 	}
 
+	LLM_SCOPE_BYNAME(TEXT("Combat"));
+	FBattleArena::FScope ArenaScope(Arena);
+
 	CurrentTurn++;
-	ActiveParticipantIndex = 0;
+	ActiveParticipantIndex = INDEX_NONE;
 
-	// Verificar se o combate acabou
-	CheckCombatEnd();
-	
-	if (!IsCombatActive())
-	{
-		return;
-	}
+	// Expirar buffs/debuffs e aplicar veneno (uma passada por todos os participantes)
+	TickStatusEffects();
 
-	// Determinar se é turno do jogador ou inimigo
-	// Por simplicidade, primeiro todos os jogadores, depois todos os inimigos
-	CurrentState = ECombatState::PlayerTurn;
-	
-	UE_LOG(LogTemp, Log, TEXT("CombatManager: Turno %d - Vez do Jogador"), CurrentTurn);
-	OnTurnChanged.Broadcast(true);
+	UE_LOG(LogTemp, Verbose, TEXT("CombatManager: Turno %d"), CurrentTurn);
+
+	// Primeiro da ordem de AGI (também verifica se o veneno encerrou o combate)
+	AdvanceActiveParticipant();
 }
 
 void ACombatManager::ExecuteAction(ECombatAction Action, AActor* Target, FName SkillID)
@@ -99,74 +255,300 @@ void ACombatManager::ExecuteAction(ECombatAction Action, AActor* Target, FName S
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("CombatManager: %s executa ação %d"), *ActiveActor->GetName(), (int32)Action);
+	LLM_SCOPE_BYNAME(TEXT("Combat"));
+	FBattleArena::FScope ArenaScope(Arena);
+
+	const int32 ActorIndex = TurnOrder[ActiveParticipantIndex];
+	const ECombatState TurnState = CurrentState;
 
 	CurrentState = ECombatState::Animating;
 
+	// Paralisado/dormindo: perde a vez (AdvanceActiveParticipant já pula; cobre chamadas diretas)
+	if (!StatusEffects.GetModifiers(ActorIndex).bCanAct)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("CombatManager: %s não pode agir!"), *ActiveActor->GetName());
+		AdvanceActiveParticipant();
+		return;
+	}
+
+	// Logs por ação são Verbose: os argumentos (FString) só são montados se a verbosidade estiver ativa
+	UE_LOG(LogTemp, Verbose, TEXT("CombatManager: %s executa ação %d"), *ActiveActor->GetName(), (int32)Action);
+
 	switch (Action)
 	{
 	case ECombatAction::Attack:
-		if (Target)
+		if (!IsParticipantActive(GetParticipantIndex(Target)))
+		{
+			// Alvo morto ou fora do combate: a vez não é consumida
+			CurrentState = TurnState;
+			return;
+		}
 		{
-			FAttackResult Result = CalculateBasicAttack(ActiveActor, Target);
-			OnDamageDealt.Broadcast(Target, Result);
-			
-			// TODO: Aplicar dano ao target
-			UE_LOG(LogTemp, Log, TEXT("CombatManager: Ataque causou %d de dano! Crítico: %s"), 
+			FAttackResult Result = ResolveAttack(ActiveActor, Target, MakeBasicAttack());
+			UE_LOG(LogTemp, Verbose, TEXT("CombatManager: Ataque causou %d de dano! Crítico: %s"), 
 				Result.Damage, Result.bCritical ? TEXT("Sim") : TEXT("Não"));
 		}
 		break;
 
 	case ECombatAction::Skill:
-		// TODO: Implementar uso de skills
+		if (!ExecuteSkill(ActiveActor, SkillID, Target))
+		{
+			// Skill inválida, sem MP ou sem alvo válido: escolher de novo
+			CurrentState = TurnState;
+			return;
+		}
 		break;
 
 	case ECombatAction::Item:
-		// TODO: Implementar uso de itens
+		// SkillID carrega o ID do item
+		if (!UseItem(ActiveActor, SkillID, Target))
+		{
+			// Item indisponível ou sem alvo válido: escolher de novo
+			CurrentState = TurnState;
+			return;
+		}
 		break;
 
 	case ECombatAction::Guard:
-		// TODO: Implementar defesa
+		// Defesa dura até o início do próximo turno
+		StatusEffects.ApplyEffect(ActorIndex, EStatusEffect::Guard, CurrentTurn, 1);
+		UE_LOG(LogTemp, Verbose, TEXT("CombatManager: %s está defendendo"), *ActiveActor->GetName());
 		break;
 
 	case ECombatAction::Escape:
-		TryEscape();
-		return;
+		if (TryEscape())
+		{
+			// O combate já acabou
+			return;
+		}
+		// Fuga falha gasta a vez
+		break;
 
 	case ECombatAction::Talk:
-		// TODO: Implementar sistema de negociação
+		if (BeginNegotiation(Cast<AEnemyBase>(Target)))
+		{
+			// A vez só passa quando a conversa terminar (RespondToNegotiation)
+			return;
+		}
 		break;
 	}
 
-	// Próximo participante ou próximo turno
-	ActiveParticipantIndex++;
-	
-	if (IsPlayerTurn() && ActiveParticipantIndex >= PlayerParty.Num())
+	AdvanceActiveParticipant();
+}
+
+void ACombatManager::AdvanceActiveParticipant()
+{
+	// A ação pode ter derrotado o último inimigo (ou o atacante, por reflexão)
+	CheckCombatEnd();
+	if (!IsCombatActive())
 	{
-		// Todos os jogadores agiram, turno dos inimigos
-		CurrentState = ECombatState::EnemyTurn;
-		ActiveParticipantIndex = 0;
-		OnTurnChanged.Broadcast(false);
-		ProcessEnemyTurn();
+		return;
+	}
+
+	// Próximo da ordem de turnos; mortos, quem saiu do combate e paralisados/dormindo
+	// perdem a vez sem que ela seja anunciada
+	do
+	{
+		ActiveParticipantIndex++;
 	}
-	else if (!IsPlayerTurn() && ActiveParticipantIndex >= Enemies.Num())
+	while (TurnOrder.IsValidIndex(ActiveParticipantIndex) && !CanParticipantAct(TurnOrder[ActiveParticipantIndex]));
+
+	if (!TurnOrder.IsValidIndex(ActiveParticipantIndex))
 	{
-		// Todos os inimigos agiram, próximo turno
+		// Todos agiram, próximo turno
 		NextTurn();
+		return;
 	}
-	else
+
+	const bool bPlayerTurn = TurnOrder[ActiveParticipantIndex] < PlayerParty.Num();
+	CurrentState = bPlayerTurn ? ECombatState::PlayerTurn : ECombatState::EnemyTurn;
+	BroadcastTurnChanged(bPlayerTurn);
+
+	if (!bPlayerTurn)
 	{
-		CurrentState = IsPlayerTurn() ? ECombatState::PlayerTurn : ECombatState::EnemyTurn;
+		ProcessEnemyTurn();
+	}
+}
+
+bool ACombatManager::ExecuteSkill(AActor* User, FName SkillID, AActor* Target)
+{
+	UCombatantComponent* UserCombatant = GetCombatant(User);
+	const FSkillData* Skill = UserCombatant ? UserCombatant->FindSkill(SkillID) : nullptr;
+	if (!Skill)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CombatManager: %s não conhece a skill %s"), *User->GetName(), *SkillID.ToString());
+		return false;
+	}
+
+	if (UserCombatant->GetStats().CurrentMP < Skill->MPCost)
+	{
+		UE_LOG(LogTemp, Log, TEXT("CombatManager: MP insuficiente para %s"), *SkillID.ToString());
+		return false;
+	}
+
+	FBattleTargetArray Targets;
+	GatherSkillTargets(User, *Skill, Target, Targets);
+	if (Targets.Num() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("CombatManager: %s sem alvo válido"), *SkillID.ToString());
+		return false;
+	}
+
+	UserCombatant->ModifyMP(-Skill->MPCost);
+	ResolveSkillOnTargets(User, *Skill, Targets);
+	return true;
+}
+
+bool ACombatManager::UseItem(AActor* User, FName ItemID, AActor* Target)
+{
+	UInventorySubsystem* Inventory = GetGameInstance() ? GetGameInstance()->GetSubsystem<UInventorySubsystem>() : nullptr;
+	const FItemData* Item = Inventory ? Inventory->FindItemData(ItemID) : nullptr;
+	if (!Item || Inventory->GetItemCount(ItemID) <= 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("CombatManager: Item %s indisponível"), *ItemID.ToString());
+		return false;
+	}
+
+	// Itens são resolvidos como skills sem custo
+	const FSkillData ItemSkill = Item->ToSkillData();
+
+	// Alvos antes do consumo: um item sem alvo válido não é gasto
+	FBattleTargetArray Targets;
+	GatherSkillTargets(User, ItemSkill, Target, Targets);
+	if (Targets.Num() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("CombatManager: %s sem alvo válido"), *ItemID.ToString());
+		return false;
+	}
+
+	Inventory->RemoveItem(ItemID);
+	ResolveSkillOnTargets(User, ItemSkill, Targets);
+	return true;
+}
+
+void ACombatManager::GatherSkillTargets(AActor* User, const FSkillData& Skill, AActor* Target, FBattleTargetArray& OutTargets) const
+{
+	OutTargets.Reset();
+
+	// Lado oposto por padrão; o próprio lado para buffs/curas
+	const bool bUserIsPlayer = PlayerParty.Contains(User);
+	const TArray<AActor*>& TargetSide = (bUserIsPlayer != Skill.bTargetsAllies) ? Enemies : PlayerParty;
+
+	// Reviver alcança aliados mortos (mas não os que saíram do combate)
+	const bool bIncludeDead = Skill.EffectType == ESkillEffectType::Revive;
+	auto IsValidTarget = [this, bIncludeDead](const AActor* Participant)
+	{
+		const int32 Index = GetParticipantIndex(Participant);
+		return bIncludeDead ? DepartedParticipants.IsValidIndex(Index) && !DepartedParticipants[Index] : IsParticipantActive(Index);
+	};
+
+	if (Skill.bTargetsAll)
+	{
+		for (AActor* Participant : TargetSide)
+		{
+			if (IsValidTarget(Participant))
+			{
+				OutTargets.Add(Participant);
+			}
+		}
+	}
+	else if (Target && TargetSide.Contains(Target) && IsValidTarget(Target))
+	{
+		OutTargets.Add(Target);
+	}
+}
+
+void ACombatManager::ResolveSkillOnTargets(AActor* User, const FSkillData& Skill, TConstArrayView<AActor*> Targets)
+{
+	for (AActor* Target : Targets)
+	{
+		const int32 TargetIndex = GetParticipantIndex(Target);
+		UCombatantComponent* TargetCombatant = GetCombatant(Target);
+		bool bLanded = true;
+
+		switch (Skill.EffectType)
+		{
+		case ESkillEffectType::Damage:
+			if (Skill.BasePower > 0)
+			{
+				// Reflexões são resolvidas dentro do próprio resultado, sem reentrar aqui
+				const FAttackResult Result = ResolveAttack(User, Target, Skill);
+
+				// Status só pega se o golpe acertou o alvo de fato
+				bLanded = Result.bHit && Result.Recipient == Target && !Result.bHealed && Result.Damage > 0;
+
+				UE_LOG(LogTemp, Verbose, TEXT("CombatManager: %s causou %d de dano em %s"), 
+					*Skill.SkillID.ToString(), Result.Damage, *GetNameSafe(Result.Recipient));
+			}
+			break;
+
+		case ESkillEffectType::HealHP:
+			if (TargetCombatant && !TargetCombatant->IsDead())
+			{
+				TargetCombatant->ModifyHP(Skill.BasePower);
+			}
+			break;
+
+		case ESkillEffectType::HealMP:
+			if (TargetCombatant && !TargetCombatant->IsDead())
+			{
+				TargetCombatant->ModifyMP(Skill.BasePower);
+			}
+			break;
+
+		case ESkillEffectType::Revive:
+			// BasePower = % do HP máximo
+			if (TargetCombatant && TargetCombatant->IsDead())
+			{
+				TargetCombatant->ModifyHP(FMath::Max(1, TargetCombatant->GetStats().MaxHP * Skill.BasePower / 100));
+			}
+			break;
+
+		case ESkillEffectType::CureStatus:
+			StatusEffects.RemoveEffect(TargetIndex, Skill.StatusEffect);
+			continue;
+
+		case ESkillEffectType::StatusOnly:
+			break;
+		}
+
+		if (bLanded && Skill.StatusEffect != EStatusEffect::None && FCombatMath::Chance(BattleRandom, FCombatMath::PercentToPermille(Skill.StatusChance)))
+		{
+			StatusEffects.ApplyEffect(TargetIndex, Skill.StatusEffect, CurrentTurn, Skill.StatusDuration);
+		}
+	}
+}
+
+void ACombatManager::TickStatusEffects()
+{
+	StatusEffects.TickTurn(CurrentTurn, PoisonedParticipants);
+
+	// Veneno: 1/8 do HP máximo por turno, mas nunca mata (nem atinge mortos e quem saiu do combate)
+	for (int32 Index : PoisonedParticipants)
+	{
+		if (!IsParticipantActive(Index))
+		{
+			continue;
+		}
+
+		UCombatantComponent* Combatant = ParticipantCombatants[Index];
+		const FCharacterStats& Stats = Combatant->GetStats();
+		const int32 PoisonDamage = FMath::Max(0, FMath::Min(FMath::Max(1, Stats.MaxHP / 8), Stats.CurrentHP - 1));
+		if (PoisonDamage > 0)
+		{
+			Combatant->ModifyHP(-PoisonDamage);
+		}
 	}
 }
 
 bool ACombatManager::TryEscape()
 {
-	// Chance de fuga baseada em Agility
-	// Por enquanto, 50% de chance
-	float EscapeChance = 50.0f;
+	// Chance de fuga baseada em Agility: 50% base, +2% por ponto de AGI médio acima dos inimigos
+	// (médias em milésimos de ponto: +20 permilagem por ponto = delta / 50)
+	const int32 AgilityDelta = GetAverageAgility(PlayerParty) - GetAverageAgility(Enemies);
+	const int32 EscapeChance = FMath::Clamp(500 + AgilityDelta / 50, 100, 950);
 	
-	if (FMath::FRandRange(0.0f, 100.0f) < EscapeChance)
+	if (FCombatMath::Chance(BattleRandom, EscapeChance))
 	{
 		UE_LOG(LogTemp, Log, TEXT("CombatManager: Fuga bem sucedida!"));
 		EndCombat(ECombatState::Escaped);
@@ -177,48 +559,143 @@ bool ACombatManager::TryEscape()
 	return false;
 }
 
+void ACombatManager::SelectDamageFormula()
+{
+	CalculateDamageFn = FDamageFormulas::Dispatch(DamageFormula, [](auto Formula) -> FCalculateDamageFn
+	{
+		return &ACombatManager::CalculateDamageWithFormula<decltype(Formula)>;
+	});
+}
+
 FAttackResult ACombatManager::CalculateDamage(AActor* Attacker, AActor* Defender, const FSkillData& Skill)
 {
-	FAttackResult Result;
-	
-	// TODO: Obter stats do Attacker e Defender
-	// Por enquanto, usar valores placeholder
-	int32 AttackStat = Skill.Element == ERPGElement::Physical ? 10 : 10; // STR ou MAG
-	int32 DefenseStat = Skill.Element == ERPGElement::Physical ? 10 : 10; // VIT ou MAG
+	return (this->*CalculateDamageFn)(Attacker, Defender, Skill);
+}
+
+FDamageInput ACombatManager::MakeDamageInput(AActor* Attacker, AActor* Defender, const FSkillData& Skill) const
+{
+	const UCombatantComponent* AttackerCombatant = GetCombatant(Attacker);
+	const UCombatantComponent* DefenderCombatant = GetCombatant(Defender);
+
+	// Buffs/debuffs já agregados pelo sistema de status
+	const FStatusModifiers& AttackerModifiers = StatusEffects.GetModifiers(GetParticipantIndex(Attacker));
+	const FStatusModifiers& DefenderModifiers = StatusEffects.GetModifiers(GetParticipantIndex(Defender));
+
+	// Sem combatente, usar valores neutros
+	FDamageInput Input;
+	Input.Power = Skill.BasePower;
+	Input.AccuracyPermille = FCombatMath::PercentToPermille(Skill.Accuracy);
+	Input.AttackStat = AttackerCombatant ? AttackerCombatant->GetAttackStat(Skill.Element) : 10;    // STR ou MAG
+	Input.DefenseStat = DefenderCombatant ? DefenderCombatant->GetDefenseStat(Skill.Element) : 10;  // VIT ou MAG
+	Input.AttackerAgility = AttackerCombatant ? AttackerCombatant->GetAgility() : 10;
+	Input.DefenderAgility = DefenderCombatant ? DefenderCombatant->GetAgility() : 10;
+	Input.AttackerLuck = AttackerCombatant ? AttackerCombatant->GetLuck() : 10;
+	Input.DefenderLuck = DefenderCombatant ? DefenderCombatant->GetLuck() : 10;
+	Input.AttackerAffinity = AttackerCombatant ? AttackerCombatant->Affinities.GetAffinity(Skill.Element) : EElementAffinity::Normal;
+	Input.DefenderAffinity = DefenderCombatant ? DefenderCombatant->Affinities.GetAffinity(Skill.Element) : EElementAffinity::Normal;
+	Input.HitBonus = AttackerModifiers.HitEvasionBonus - DefenderModifiers.HitEvasionBonus;
+	Input.AttackPermille = AttackerModifiers.AttackPermille;
+	Input.AttackerTakenPermille = AttackerModifiers.DamageTakenPermille;
+	Input.DefenderTakenPermille = DefenderModifiers.DamageTakenPermille;
+	return Input;
+}
+
+template<typename TFormula>
+FAttackResult ACombatManager::CalculateDamageWithFormula(AActor* Attacker, AActor* Defender, const FSkillData& Skill)
+{
+	const FDamageInput Input = MakeDamageInput(Attacker, Defender, Skill);
+
+	// Mesmo pipeline inteiro usado pelo simulador em lote, só com o BattleRandom
+	const FDamageOutcome Outcome = FDamageFormulas::Resolve<TFormula>(Input, BattleRandom);
 
-	// Verificar acerto
-	float HitRoll = FMath::FRandRange(0.0f, 100.0f);
-	if (HitRoll > Skill.Accuracy)
+	FAttackResult Result;
+	Result.bHit = Outcome.bHit;
+	Result.bCritical = Outcome.bCritical;
+	Result.bHealed = Outcome.bHealed;
+	Result.Damage = Outcome.Damage;
+	if (Outcome.bHit)
 	{
-		Result.bHit = false;
-		Result.Damage = 0;
-		return Result;
+		Result.AffinityResult = Input.DefenderAffinity;
+		Result.Recipient = Outcome.bReflected ? Attacker : Defender;
 	}
+	return Result;
+}
+
+void ACombatManager::ComputeDamageDistribution(AActor* Attacker, AActor* Defender, const FSkillData& Skill, FDamageDistribution& Out) const
+{
+	const FDamageInput Input = MakeDamageInput(Attacker, Defender, Skill);
+	FDamageFormulas::Dispatch(DamageFormula, [&Input, &Out](auto Formula)
+	{
+		FDamageFormulas::Distribution<decltype(Formula)>(Input, Out);
+	});
+}
+
+FDamagePreview ACombatManager::PreviewDamage(AActor* Attacker, AActor* Defender, const FSkillData& Skill) const
+{
+	FDamageDistribution Distribution;
+	ComputeDamageDistribution(Attacker, Defender, Skill, Distribution);
 
-	// Calcular dano base
-	// Fórmula: (BasePower + AttackStat) * random(0.9-1.1) - DefenseStat/2
-	float RandomMod = FMath::FRandRange(0.9f, 1.1f);
-	int32 BaseDamage = FMath::Max(1, (int32)((Skill.BasePower + AttackStat) * RandomMod) - (DefenseStat / 2));
+	FDamagePreview Preview;
+	Preview.HitChance = Distribution.HitChancePermille / (float)FCombatMath::One;
+	Preview.CritChance = Distribution.CritChancePermille / (float)FCombatMath::One;
+	Preview.MinDamage = Distribution.GetMinDamage();
+	Preview.MaxDamage = Distribution.GetMaxDamage();
+	Preview.ExpectedDamage = (float)Distribution.GetExpectedDamage();
+	Preview.ExpectedDamageOnHit = (float)Distribution.GetExpectedDamageOnHit();
+	Preview.AffinityResult = GetCombatant(Defender) ? GetCombatant(Defender)->Affinities.GetAffinity(Skill.Element) : EElementAffinity::Normal;
+	Preview.bHealed = Distribution.bHealed;
+	Preview.bReflected = Distribution.bReflected;
 
-	// TODO: Verificar afinidade do defensor
-	Result.AffinityResult = EElementAffinity::Normal;
-	float AffinityMult = GetAffinityMultiplier(Result.AffinityResult);
+	// Cura nunca derruba; o recipiente de Repel é o próprio atacante
+	const UCombatantComponent* RecipientCombatant = GetCombatant(Distribution.bReflected ? Attacker : Defender);
+	if (RecipientCombatant && !Distribution.bHealed)
+	{
+		Preview.KillChance = (float)Distribution.GetChanceAtLeast(FMath::Max(1, RecipientCombatant->GetStats().CurrentHP));
+	}
 
-	// Verificar crítico (baseado em LUK)
-	float CritChance = 5.0f; // 5% base
-	if (FMath::FRandRange(0.0f, 100.0f) < CritChance)
+	// Faixas iguais entre o menor e o maior dano com efeito
+	if (Preview.MaxDamage > 0)
 	{
-		Result.bCritical = true;
-		AffinityMult *= 1.5f;
+		const int32 Range = Preview.MaxDamage - Preview.MinDamage + 1;
+		const int32 NumBuckets = FMath::Min(FDamagePreview::NumHistogramBuckets, Range);
+		Preview.Histogram.SetNumZeroed(NumBuckets);
+
+		for (int32 i = 0; i < Distribution.Bins.Num(); i++)
+		{
+			const FDamageBin& Bin = Distribution.Bins[i];
+			if (Bin.Damage > 0)
+			{
+				const int32 Bucket = (int32)((int64)(Bin.Damage - Preview.MinDamage) * NumBuckets / Range);
+				Preview.Histogram[Bucket] += (float)Distribution.GetProbability(i);
+			}
+		}
 	}
 
-	Result.Damage = FMath::Max(1, (int32)(BaseDamage * AffinityMult));
-	Result.bHit = true;
+	return Preview;
+}
 
+FAttackResult ACombatManager::ResolveAttack(AActor* Attacker, AActor* Defender, const FSkillData& Skill)
+{
+	const FAttackResult Result = CalculateDamage(Attacker, Defender, Skill);
+	ApplyAttackResult(Result);
+
+	// Repel: quem recebe é o atacante (errar ainda é mostrado no alvo original)
+	BroadcastDamageDealt(Result.Recipient ? Result.Recipient : Defender, Result);
 	return Result;
 }
 
-FAttackResult ACombatManager::CalculateBasicAttack(AActor* Attacker, AActor* Defender)
+void ACombatManager::ApplyAttackResult(const FAttackResult& Result)
+{
+	UCombatantComponent* RecipientCombatant = Result.bHit ? GetCombatant(Result.Recipient) : nullptr;
+	if (!RecipientCombatant || Result.Damage <= 0)
+	{
+		return;
+	}
+
+	RecipientCombatant->ModifyHP(Result.bHealed ? Result.Damage : -Result.Damage);
+}
+
+FSkillData ACombatManager::MakeBasicAttack()
 {
 	// Ataque básico físico
 	FSkillData BasicAttack;
@@ -226,47 +703,76 @@ FAttackResult ACombatManager::CalculateBasicAttack(AActor* Attacker, AActor* Def
 	BasicAttack.Element = ERPGElement::Physical;
 	BasicAttack.BasePower = 30;
 	BasicAttack.Accuracy = 90.0f;
+	return BasicAttack;
+}
 
-	return CalculateDamage(Attacker, Defender, BasicAttack);
+FAttackResult ACombatManager::CalculateBasicAttack(AActor* Attacker, AActor* Defender)
+{
+	return CalculateDamage(Attacker, Defender, MakeBasicAttack());
 }
 
 float ACombatManager::GetAffinityMultiplier(EElementAffinity Affinity)
 {
-	switch (Affinity)
+	// Só para exibição; as fórmulas usam a permilagem diretamente
+	return FCombatMath::GetAffinityPermille(Affinity) / (float)FCombatMath::One;
+}
+
+// ==================== EVENTOS ====================
+
+void ACombatManager::BroadcastCombatStarted()
+{
+	EventBus.OnCombatStarted.Broadcast();
+	if (OnCombatStarted.IsBound())
 	{
-	case EElementAffinity::Weak:   return 2.0f;
-	case EElementAffinity::Resist: return 0.5f;
-	case EElementAffinity::Null:   return 0.0f;
-	case EElementAffinity::Repel:  return -1.0f;  // Dano refletido
-	case EElementAffinity::Drain:  return -0.5f;  // Cura em vez de dano
-	default:                       return 1.0f;
+		OnCombatStarted.Broadcast();
 	}
 }
 
-AActor* ACombatManager::GetActiveParticipant() const
+void ACombatManager::BroadcastCombatEnded(ECombatState EndState)
 {
-	if (IsPlayerTurn())
+	EventBus.OnCombatEnded.Broadcast(EndState);
+	if (OnCombatEnded.IsBound())
 	{
-		if (PlayerParty.IsValidIndex(ActiveParticipantIndex))
-		{
-			return PlayerParty[ActiveParticipantIndex];
-		}
+		OnCombatEnded.Broadcast(EndState);
 	}
-	else
+}
+
+void ACombatManager::BroadcastTurnChanged(bool bIsPlayerTurn)
+{
+	EventBus.OnTurnChanged.Broadcast(bIsPlayerTurn);
+	if (OnTurnChanged.IsBound())
 	{
-		if (Enemies.IsValidIndex(ActiveParticipantIndex))
-		{
-			return Enemies[ActiveParticipantIndex];
-		}
+		OnTurnChanged.Broadcast(bIsPlayerTurn);
 	}
-	return nullptr;
+}
+
+void ACombatManager::BroadcastDamageDealt(AActor* Target, const FAttackResult& Result)
+{
+	EventBus.OnDamageDealt.Broadcast(Target, Result);
+	if (OnDamageDealt.IsBound())
+	{
+		OnDamageDealt.Broadcast(Target, Result);
+	}
+}
+
+void ACombatManager::BroadcastNegotiationEnded(AActor* Demon, ENegotiationOutcome Outcome)
+{
+	EventBus.OnNegotiationEnded.Broadcast(Demon, Outcome);
+	if (OnNegotiationEnded.IsBound())
+	{
+		OnNegotiationEnded.Broadcast(Demon, Outcome);
+	}
+}
+
+AActor* ACombatManager::GetActiveParticipant() const
+{
+	return TurnOrder.IsValidIndex(ActiveParticipantIndex) ? GetParticipantByIndex(TurnOrder[ActiveParticipantIndex]) : nullptr;
 }
 
 void ACombatManager::CheckCombatEnd()
 {
 	// Verificar se todos os inimigos foram derrotados
-	// TODO: Verificar HP dos inimigos
-	bool bAllEnemiesDefeated = Enemies.Num() == 0;
+	bool bAllEnemiesDefeated = IsSideDefeated(Enemies);
 	
 	if (bAllEnemiesDefeated)
 	{
@@ -275,8 +781,7 @@ void ACombatManager::CheckCombatEnd()
 	}
 
 	// Verificar se todos os jogadores foram derrotados
-	// TODO: Verificar HP dos jogadores
-	bool bAllPlayersDefeated = PlayerParty.Num() == 0;
+	bool bAllPlayersDefeated = IsSideDefeated(PlayerParty);
 	
 	if (bAllPlayersDefeated)
 	{
@@ -287,33 +792,382 @@ void ACombatManager::CheckCombatEnd()
 
 void ACombatManager::DetermineTurnOrder()
 {
-	TurnOrder.Empty();
-	
-	// Combinar todos os participantes
-	TurnOrder.Append(PlayerParty);
-	TurnOrder.Append(Enemies);
-
-	// TODO: Ordenar por Agility
-	// Por enquanto, ordem de inserção
+	FCombatMath::BuildTurnOrder(TurnOrder, ParticipantCombatants.Num(), [this](int32 Index)
+	{
+		const UCombatantComponent* Combatant = ParticipantCombatants[Index];
+		return Combatant ? Combatant->GetAgility() : 0;
+	});
 }
 
 void ACombatManager::ProcessEnemyTurn()
 {
-	UE_LOG(LogTemp, Log, TEXT("CombatManager: Turno do Inimigo"));
+	AActor* Actor = GetActiveParticipant();
+	UE_LOG(LogTemp, Verbose, TEXT("CombatManager: Vez do inimigo %s"), *GetNameSafe(Actor));
 
-	// IA simples: cada inimigo ataca um jogador aleatório
-	for (int32 i = 0; i < Enemies.Num(); i++)
+	// IA simples: o inimigo escolhe uma skill (ou ataque básico) e depois um alvo ativo aleatório
+	// Skill desconhecida ou sem MP: ataque básico (uma skill recusada não passaria a vez)
+	AEnemyBase* Enemy = Cast<AEnemyBase>(Actor);
+	// A IA sorteia com uma semente do próprio BattleRandom (uma rolagem por decisão)
+	const FSkillData Choice = Enemy ? Enemy->SelectAction((int32)BattleRandom.GetUnsignedInt()) : FSkillData();
+	const FSkillData* Known = Enemy ? Enemy->Combatant->FindSkill(Choice.SkillID) : nullptr;
+	const bool bUseSkill = Known && Enemy->Combatant->GetStats().CurrentMP >= Known->MPCost;
+
+	// Curas/buffs vão para o próprio lado
+	AActor* Target = PickRandomActiveParticipant(bUseSkill && Known->bTargetsAllies ? Enemies : PlayerParty);
+	if (!Target)
 	{
-		if (PlayerParty.Num() > 0)
+		return;
+	}
+
+	if (bUseSkill)
+	{
+		ExecuteAction(ECombatAction::Skill, Target, Choice.SkillID);
+	}
+	else
+	{
+		ExecuteAction(ECombatAction::Attack, Target);
+	}
+}
+
+AActor* ACombatManager::PickRandomActiveParticipant(const TArray<AActor*>& Side)
+{
+	int32 NumActive = 0;
+	for (const AActor* Participant : Side)
+	{
+		NumActive += IsParticipantActive(GetParticipantIndex(Participant)) ? 1 : 0;
+	}
+
+	if (NumActive == 0)
+	{
+		return nullptr;
+	}
+
+	// Sorteia entre os ativos sem montar lista
+	int32 Remaining = FCombatMath::RandRange(BattleRandom, 0, NumActive - 1);
+	for (AActor* Participant : Side)
+	{
+		if (IsParticipantActive(GetParticipantIndex(Participant)) && Remaining-- == 0)
 		{
-			int32 RandomTarget = FMath::RandRange(0, PlayerParty.Num() - 1);
-			AActor* Target = PlayerParty[RandomTarget];
-			
-			ActiveParticipantIndex = i;
-			ExecuteAction(ECombatAction::Attack, Target);
+			return Participant;
 		}
 	}
+	return nullptr;
+}
 
-	// Voltar para o turno do jogador
-	NextTurn();
+// ==================== NOTIFICAÇÃO DE STATS ====================
+
+int32 ACombatManager::GetParticipantIndex(const AActor* Participant) const
+{
+	int32 Index = PlayerParty.IndexOfByKey(Participant);
+	if (Index != INDEX_NONE)
+	{
+		return Index;
+	}
+
+	Index = Enemies.IndexOfByKey(Participant);
+	return Index != INDEX_NONE ? PlayerParty.Num() + Index : INDEX_NONE;
+}
+
+AActor* ACombatManager::GetParticipantByIndex(int32 Index) const
+{
+	if (PlayerParty.IsValidIndex(Index))
+	{
+		return PlayerParty[Index];
+	}
+
+	Index -= PlayerParty.Num();
+	return Enemies.IsValidIndex(Index) ? Enemies[Index] : nullptr;
+}
+
+void ACombatManager::MarkParticipantDirty(AActor* Participant)
+{
+	const int32 Index = GetParticipantIndex(Participant);
+	if (DirtyParticipants.IsValidIndex(Index))
+	{
+		DirtyParticipants[Index] = true;
+	}
+}
+
+void ACombatManager::HandleParticipantStatsChanged(AActor* Participant)
+{
+	MarkParticipantDirty(Participant);
+	EventBus.OnParticipantStatsChanged.Broadcast(Participant);
+}
+
+void ACombatManager::ConsumeDirtyParticipants(TArray<FParticipantStatsSnapshot>& OutSnapshots)
+{
+	OutSnapshots.Reset();
+
+	for (TConstSetBitIterator<> It(DirtyParticipants); It; ++It)
+	{
+		AActor* Participant = GetParticipantByIndex(It.GetIndex());
+
+		if (const UCombatantComponent* Combatant = ParticipantCombatants[It.GetIndex()])
+		{
+			const FCharacterStats& Stats = Combatant->GetStats();
+			FParticipantStatsSnapshot& Snapshot = OutSnapshots.AddDefaulted_GetRef();
+			Snapshot.Participant = Participant;
+			Snapshot.CurrentHP = Stats.CurrentHP;
+			Snapshot.MaxHP = Stats.MaxHP;
+			Snapshot.CurrentMP = Stats.CurrentMP;
+			Snapshot.MaxMP = Stats.MaxMP;
+		}
+	}
+
+	DirtyParticipants.SetRange(0, DirtyParticipants.Num(), false);
+}
+
+void ACombatManager::BindParticipantStatEvents()
+{
+	for (UCombatantComponent* Combatant : ParticipantCombatants)
+	{
+		if (Combatant)
+		{
+			Combatant->OnStatsChanged.AddUObject(this, &ACombatManager::HandleParticipantStatsChanged);
+		}
+	}
+}
+
+void ACombatManager::UnbindParticipantStatEvents()
+{
+	for (UCombatantComponent* Combatant : ParticipantCombatants)
+	{
+		if (Combatant)
+		{
+			Combatant->OnStatsChanged.RemoveAll(this);
+		}
+	}
+}
+
+// ==================== COMBATENTES ====================
+
+void ACombatManager::CacheParticipantCombatants()
+{
+	ParticipantCombatants.Reset(PlayerParty.Num() + Enemies.Num());
+
+	for (AActor* Player : PlayerParty)
+	{
+		ParticipantCombatants.Add(UCombatantComponent::FindCombatant(Player));
+	}
+
+	for (AActor* Enemy : Enemies)
+	{
+		ParticipantCombatants.Add(UCombatantComponent::FindCombatant(Enemy));
+	}
+}
+
+UCombatantComponent* ACombatManager::GetCombatant(const AActor* Participant) const
+{
+	const int32 Index = GetParticipantIndex(Participant);
+	if (ParticipantCombatants.IsValidIndex(Index))
+	{
+		return ParticipantCombatants[Index];
+	}
+
+	// Fora de combate (ex: preview de dano), buscar no ator
+	return UCombatantComponent::FindCombatant(Participant);
+}
+
+bool ACombatManager::IsSideDefeated(const TArray<AActor*>& Side) const
+{
+	for (const AActor* Participant : Side)
+	{
+		if (IsParticipantActive(GetParticipantIndex(Participant)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ACombatManager::IsParticipantActive(int32 Index) const
+{
+	const UCombatantComponent* Combatant = ParticipantCombatants.IsValidIndex(Index) ? ParticipantCombatants[Index] : nullptr;
+	return Combatant && !Combatant->IsDead() && !(DepartedParticipants.IsValidIndex(Index) && DepartedParticipants[Index]);
+}
+
+bool ACombatManager::CanParticipantAct(int32 Index) const
+{
+	if (!IsParticipantActive(Index))
+	{
+		return false;
+	}
+
+	if (!StatusEffects.GetModifiers(Index).bCanAct)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("CombatManager: %s não pode agir!"), *GetNameSafe(GetParticipantByIndex(Index)));
+		return false;
+	}
+	return true;
+}
+
+int32 ACombatManager::GetAverageAgility(const TArray<AActor*>& Side) const
+{
+	int32 TotalAgility = 0;
+	int32 Count = 0;
+
+	// Mortos e quem saiu do combate não contam
+	for (const AActor* Participant : Side)
+	{
+		const int32 Index = GetParticipantIndex(Participant);
+		if (IsParticipantActive(Index))
+		{
+			TotalAgility += ParticipantCombatants[Index]->GetAgility();
+			Count++;
+		}
+	}
+
+	return Count > 0 ? TotalAgility * FCombatMath::One / Count : 0;
+}
+
+// ==================== NEGOCIAÇÃO ====================
+
+bool ACombatManager::BeginNegotiation(AEnemyBase* Demon)
+{
+	if (!Demon || !Demon->NegotiationGraph || !IsParticipantActive(GetParticipantIndex(Demon)))
+	{
+		UE_LOG(LogTemp, Log, TEXT("CombatManager: O alvo não quer conversar"));
+		return false;
+	}
+
+	NegotiationTarget = Demon;
+	Negotiation.Start(Demon->NegotiationGraph->GetBakedGraph(), Demon->Personality);
+	CurrentState = ECombatState::Negotiating;
+
+	UE_LOG(LogTemp, Log, TEXT("CombatManager: Negociando com %s (humor %d)"), *Demon->EnemyName.ToString(), Negotiation.Mood);
+
+	// Grafo vazio termina na hora
+	if (!Negotiation.IsActive())
+	{
+		FinishNegotiation(Negotiation.Outcome);
+	}
+	return true;
+}
+
+void ACombatManager::RespondToNegotiation(int32 ResponseIndex)
+{
+	if (CurrentState != ECombatState::Negotiating || !Negotiation.IsActive())
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYNAME(TEXT("Combat"));
+	FBattleArena::FScope ArenaScope(Arena);
+
+	UJGameInstance* GameInstance = Cast<UJGameInstance>(GetGameInstance());
+
+	FNegotiationContext Context;
+	Context.Money = GameInstance ? GameInstance->PlayerGold : 0;
+
+	UInventorySubsystem* Inventory = GameInstance ? GameInstance->GetSubsystem<UInventorySubsystem>() : nullptr;
+	const FNegotiationBakedNode* Node = Negotiation.GetCurrentNode();
+	if (Inventory && Node && !Node->DemandItem.IsNone())
+	{
+		Context.HeldDemandItemCount = Inventory->GetItemCount(Node->DemandItem);
+	}
+
+	FNegotiationPayment Payment;
+	const ENegotiationOutcome Outcome = Negotiation.Respond(ResponseIndex, Context, BattleRandom, Payment);
+
+	if (GameInstance && Payment.Money > 0)
+	{
+		GameInstance->PlayerGold -= Payment.Money;
+	}
+
+	if (Inventory && Payment.ItemCount > 0)
+	{
+		Inventory->RemoveItem(Payment.Item, Payment.ItemCount);
+	}
+
+	if (Outcome != ENegotiationOutcome::None)
+	{
+		FinishNegotiation(Outcome);
+	}
+}
+
+void ACombatManager::FinishNegotiation(ENegotiationOutcome Outcome)
+{
+	AEnemyBase* Demon = NegotiationTarget;
+	NegotiationTarget = nullptr;
+
+	if (Demon)
+	{
+		UE_LOG(LogTemp, Log, TEXT("CombatManager: Negociação com %s terminou: %d"), *Demon->EnemyName.ToString(), (int32)Outcome);
+
+		// Sai do combate sem morrer
+		auto Depart = [this, Demon]()
+		{
+			const int32 Index = GetParticipantIndex(Demon);
+			if (DepartedParticipants.IsValidIndex(Index))
+			{
+				DepartedParticipants[Index] = true;
+			}
+			Demon->SetActorHiddenInGame(true);
+		};
+
+		switch (Outcome)
+		{
+		case ENegotiationOutcome::Gift:
+			if (UJGameInstance* GameInstance = Cast<UJGameInstance>(GetGameInstance()))
+			{
+				GameInstance->PlayerGold += Demon->NegotiationGraph->GiftMoney;
+
+				UInventorySubsystem* Inventory = GameInstance->GetSubsystem<UInventorySubsystem>();
+				if (Inventory && !Demon->NegotiationGraph->GiftItem.IsNone())
+				{
+					Inventory->AddItem(Demon->NegotiationGraph->GiftItem);
+				}
+			}
+			// O demônio vai embora depois do presente, sem entrar para o compêndio
+			Depart();
+			break;
+
+		case ENegotiationOutcome::Recruit:
+			if (UDemonCompendiumSubsystem* Compendium = GetGameInstance() ? GetGameInstance()->GetSubsystem<UDemonCompendiumSubsystem>() : nullptr)
+			{
+				Compendium->RecordDemon(Demon->DemonID);
+			}
+			Depart();
+			break;
+
+		case ENegotiationOutcome::Flee:
+			Depart();
+			break;
+
+		case ENegotiationOutcome::Anger:
+			// Furioso: ataque aumentado por alguns turnos
+			StatusEffects.ApplyEffect(GetParticipantIndex(Demon), EStatusEffect::Tarukaja, CurrentTurn, 3);
+			break;
+
+		default:
+			break;
+		}
+
+		BroadcastNegotiationEnded(Demon, Outcome);
+	}
+
+	// Volta ao fluxo normal e passa a vez
+	AdvanceActiveParticipant();
+}
+
+FText ACombatManager::GetNegotiationPrompt() const
+{
+	if (NegotiationTarget && Negotiation.IsActive())
+	{
+		return NegotiationTarget->NegotiationGraph->Nodes[Negotiation.NodeIndex].Prompt;
+	}
+	return FText::GetEmpty();
+}
+
+TArray<FText> ACombatManager::GetNegotiationResponses() const
+{
+	TArray<FText> Responses;
+	if (NegotiationTarget && Negotiation.IsActive())
+	{
+		for (const FNegotiationResponseDef& Response : NegotiationTarget->NegotiationGraph->Nodes[Negotiation.NodeIndex].Responses)
+		{
+			Responses.Add(Response.Text);
+		}
+	}
+	return Responses;
 }
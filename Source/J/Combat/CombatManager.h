@@ -6,9 +6,17 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/RPGTypes.h"
+#include "CombatEventBus.h"
+#include "StatusEffectSystem.h"
+#include "BattleArena.h"
+#include "Negotiation/NegotiationEngine.h"
 #include "CombatManager.generated.h"
 
 class ACombatParticipant;
+class UCombatantComponent;
+class AEnemyBase;
+struct FDamageInput;
+struct FDamageDistribution;
 
 /**
  * Enum para estado do combate
@@ -21,6 +29,7 @@ enum class ECombatState : uint8
 	PlayerTurn     UMETA(DisplayName = "Player Turn"),
 	EnemyTurn      UMETA(DisplayName = "Enemy Turn"),
 	Animating      UMETA(DisplayName = "Animating"),
+	Negotiating    UMETA(DisplayName = "Negotiating"),
 	Victory        UMETA(DisplayName = "Victory"),
 	Defeat         UMETA(DisplayName = "Defeat"),
 	Escaped        UMETA(DisplayName = "Escaped")
@@ -59,6 +68,86 @@ struct FAttackResult
 
 	UPROPERTY(BlueprintReadWrite, Category = "Combat")
 	EElementAffinity AffinityResult = EElementAffinity::Normal;
+
+	/** Quem teve o HP alterado (o próprio atacante quando o alvo reflete) */
+	UPROPERTY(BlueprintReadWrite, Category = "Combat")
+	AActor* Recipient = nullptr;
+
+	/** Damage foi aplicado como cura (Drain) */
+	UPROPERTY(BlueprintReadWrite, Category = "Combat")
+	bool bHealed = false;
+};
+
+/**
+ * Prévia de um ataque para a UI (probabilidades em 0-1)
+ * Resumo de FDamageDistribution: exata, sem amostragem.
+ */
+USTRUCT(BlueprintType)
+struct FDamagePreview
+{
+	GENERATED_BODY()
+
+	/** Faixas de Histogram */
+	static constexpr int32 NumHistogramBuckets = 16;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float HitChance = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float CritChance = 0.0f;
+
+	/** Menor e maior dano (ou cura) possível quando tem efeito */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	int32 MinDamage = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	int32 MaxDamage = 0;
+
+	/** Média contando erros como 0 */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float ExpectedDamage = 0.0f;
+
+	/** Média dado que acertou */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float ExpectedDamageOnHit = 0.0f;
+
+	/** Chance de zerar o HP atual do recipiente */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	float KillChance = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	EElementAffinity AffinityResult = EElementAffinity::Normal;
+
+	/** Cura o alvo (Drain) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	bool bHealed = false;
+
+	/** Volta para o atacante (Repel) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	bool bReflected = false;
+
+	/** Probabilidade de cada faixa igual entre MinDamage e MaxDamage (soma = chance de ter efeito) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	TArray<float> Histogram;
+};
+
+/**
+ * Recompensas de uma vitória
+ */
+USTRUCT(BlueprintType)
+struct FBattleRewards
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	int32 Experience = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	int32 Gold = 0;
+
+	/** Itens dropados (já adicionados ao inventário) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	TArray<FName> Items;
 };
 
 // Delegates
@@ -66,6 +155,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCombatStarted);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCombatEnded, ECombatState, EndState);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTurnChanged, bool, bIsPlayerTurn);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDamageDealt, AActor*, Target, const FAttackResult&, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNegotiationEnded, AActor*, Demon, ENegotiationOutcome, Outcome);
 
 /**
  * Gerenciador central do sistema de combate
@@ -97,7 +187,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Combat")
 	TArray<AActor*> Enemies;
 
-	/** Índice do participante ativo */
+	/** Posição do participante ativo na ordem de turnos (AGI) */
 	UPROPERTY(BlueprintReadOnly, Category = "Combat")
 	int32 ActiveParticipantIndex = 0;
 
@@ -105,8 +195,23 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Combat")
 	int32 CurrentTurn = 0;
 
+	/** Recompensas da última vitória (válidas a partir de OnCombatEnded) */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat")
+	FBattleRewards LastBattleRewards;
+
+	/** Seed do RNG da batalha (0 = aleatória a cada combate) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	int32 BattleSeed = 0;
+
+	/** Fórmula de dano base (aplicada no início de cada combate) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	EDamageFormula DamageFormula = EDamageFormula::Classic;
+
 	// ==================== EVENTOS ====================
 
+	/** Eventos nativos para assinantes em C++ (preferir a estes em vez dos dinâmicos) */
+	FCombatEventBus& GetEventBus() { return EventBus; }
+
 	UPROPERTY(BlueprintAssignable, Category = "Combat|Events")
 	FOnCombatStarted OnCombatStarted;
 
@@ -119,12 +224,27 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Combat|Events")
 	FOnDamageDealt OnDamageDealt;
 
+	UPROPERTY(BlueprintAssignable, Category = "Combat|Events")
+	FOnNegotiationEnded OnNegotiationEnded;
+
 	// ==================== FUNÇÕES DE CONTROLE ====================
 
 	/** Inicia um combate com os participantes especificados */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void StartCombat(const TArray<AActor*>& InPlayerParty, const TArray<AActor*>& InEnemies);
 
+	/**
+	 * Spawna os inimigos de uma composição já sorteada nos slots da formação
+	 * (relativos a ArenaOrigin) e inicia o combate contra eles. Os atores
+	 * spawnados aqui são destruídos no EndCombat.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void StartEncounter(const TArray<AActor*>& InPlayerParty, const FEncounterData& Encounter, const FEncounterSpawnDescriptor& Spawn, const FTransform& ArenaOrigin);
+
+	/** Distância entre inimigos quando o encontro não tem formação */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	float DefaultEnemySpacing = 200.0f;
+
 	/** Termina o combate */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void EndCombat(ECombatState EndState);
@@ -141,22 +261,62 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	bool TryEscape();
 
+	// ==================== NEGOCIAÇÃO ====================
+
+	/** Escolhe uma resposta na negociação em andamento */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Negotiation")
+	void RespondToNegotiation(int32 ResponseIndex);
+
+	/** Fala atual do demônio */
+	UFUNCTION(BlueprintPure, Category = "Combat|Negotiation")
+	FText GetNegotiationPrompt() const;
+
+	/** Respostas disponíveis no nó atual */
+	UFUNCTION(BlueprintPure, Category = "Combat|Negotiation")
+	TArray<FText> GetNegotiationResponses() const;
+
+	/** Humor atual do demônio (-100 a 100) */
+	UFUNCTION(BlueprintPure, Category = "Combat|Negotiation")
+	int32 GetNegotiationMood() const { return Negotiation.Mood; }
+
 	// ==================== FUNÇÕES DE CÁLCULO ====================
 
-	/** Calcula dano de um ataque */
+	/**
+	 * Calcula dano de um ataque sem aplicá-lo.
+	 * Estágios: acerto -> dano base -> afinidade (Repel redireciona ao atacante) -> crítico -> modificadores.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Combat|Calculation")
 	FAttackResult CalculateDamage(AActor* Attacker, AActor* Defender, const FSkillData& Skill);
 
+	/** Calcula, aplica (dano, cura ou reflexão) e notifica um ataque em uma única passada */
+	FAttackResult ResolveAttack(AActor* Attacker, AActor* Defender, const FSkillData& Skill);
+
 	/** Calcula dano de ataque físico básico */
 	UFUNCTION(BlueprintCallable, Category = "Combat|Calculation")
 	FAttackResult CalculateBasicAttack(AActor* Attacker, AActor* Defender);
 
-	/** Obtém o multiplicador de dano baseado na afinidade */
+	/**
+	 * Distribuição exata do dano de um ataque, sem rolar nada nem alterar o BattleRandom.
+	 * Mesmas entradas e estágios de CalculateDamage com a DamageFormula atual.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat|Calculation")
+	FDamagePreview PreviewDamage(AActor* Attacker, AActor* Defender, const FSkillData& Skill) const;
+
+	/** Versão nativa de PreviewDamage com a distribuição completa (Out é reutilizável) */
+	void ComputeDamageDistribution(AActor* Attacker, AActor* Defender, const FSkillData& Skill, FDamageDistribution& Out) const;
+
+	/** Skill equivalente ao ataque físico básico */
+	static FSkillData MakeBasicAttack();
+
+	/** Obtém o multiplicador de dano baseado na afinidade (negativo = não fere o alvo: reflete ou cura) */
 	UFUNCTION(BlueprintPure, Category = "Combat|Calculation")
 	static float GetAffinityMultiplier(EElementAffinity Affinity);
 
 	// ==================== FUNÇÕES DE QUERY ====================
 
+	/** Uso de memória do arena da batalha atual */
+	const FBattleArenaStats& GetArenaStats() const { return Arena.GetStats(); }
+
 	/** Verifica se o combate está ativo */
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	bool IsCombatActive() const { return CurrentState != ECombatState::Inactive; }
@@ -173,13 +333,157 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void CheckCombatEnd();
 
+	// ==================== NOTIFICAÇÃO DE STATS ====================
+
+	/** Marca um participante para ter HP/MP reenviados à UI no próximo flush */
+	void MarkParticipantDirty(AActor* Participant);
+
+	// ==================== COMBATENTES ====================
+
+	/** Retorna o combatente de um participante (ponteiro em cache durante o combate) */
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	UCombatantComponent* GetCombatant(const AActor* Participant) const;
+
+	/** Há participantes com stats pendentes de atualização na UI? */
+	bool HasDirtyParticipants() const { return DirtyParticipants.Contains(true); }
+
+	/**
+	 * Copia os stats dos participantes marcados para OutSnapshots e limpa as marcas.
+	 * Vários hits no mesmo alvo dentro de um frame geram um único snapshot.
+	 * As marcas continuam válidas durante OnCombatEnded, para o último flush da UI.
+	 */
+	void ConsumeDirtyParticipants(TArray<FParticipantStatsSnapshot>& OutSnapshots);
+
 protected:
 	/** Determina a ordem de ação baseada em Agility */
 	void DetermineTurnOrder();
 
-	/** Processa turno do inimigo (IA) */
+	/** Processa a vez do inimigo ativo (IA) */
 	void ProcessEnemyTurn();
 
-	/** Ordem de turnos */
-	TArray<AActor*> TurnOrder;
+	/** Passa a vez para o próximo participante ativo da ordem de turnos (ou para o próximo turno) */
+	void AdvanceActiveParticipant();
+
+	/** Usa uma skill: custo de MP, seleção de alvos e resolução em lote (false = nada foi feito) */
+	bool ExecuteSkill(AActor* User, FName SkillID, AActor* Target);
+
+	/** Usa um item do inventário pelo mesmo caminho de resolução das skills (false = nada foi gasto) */
+	bool UseItem(AActor* User, FName ItemID, AActor* Target);
+
+	/** Monta a lista de alvos de uma skill (todos do lado ou o alvo escolhido) */
+	void GatherSkillTargets(AActor* User, const FSkillData& Skill, AActor* Target, FBattleTargetArray& OutTargets) const;
+
+	/** Resolve dano, curas e efeitos de status de uma skill/item em todos os alvos */
+	void ResolveSkillOnTargets(AActor* User, const FSkillData& Skill, TConstArrayView<AActor*> Targets);
+
+	/** Expira efeitos e aplica dano de veneno no início do turno */
+	void TickStatusEffects();
+
+	/** Inicia a conversa com um demônio; false se ele não negocia */
+	bool BeginNegotiation(AEnemyBase* Demon);
+
+	/** Aplica o resultado da conversa e passa a vez */
+	void FinishNegotiation(ENegotiationOutcome Outcome);
+
+	/** Soma EXP/gold dos inimigos derrotados, sorteia drops e aplica os níveis ganhos */
+	void DistributeRewards();
+
+	/** Aplica um resultado já calculado ao Recipient */
+	void ApplyAttackResult(const FAttackResult& Result);
+
+	/** Participante ainda luta (vivo e não saiu do combate)? */
+	bool IsParticipantActive(int32 Index) const;
+
+	/** Ativo e sem status que impeça a ação (paralisia, sono)? */
+	bool CanParticipantAct(int32 Index) const;
+
+	/** Participante ativo aleatório de um lado (BattleRandom), ou nullptr */
+	AActor* PickRandomActiveParticipant(const TArray<AActor*>& Side);
+
+	/** Conversa em andamento */
+	FNegotiationSession Negotiation;
+
+	/** Demônio com quem estamos conversando */
+	UPROPERTY(Transient)
+	AEnemyBase* NegotiationTarget = nullptr;
+
+	/** Participantes que saíram do combate (recrutados, fugiram...); inline até 128 participantes */
+	TBitArray<> DepartedParticipants;
+
+	/** RNG da batalha */
+	FRandomStream BattleRandom;
+
+	/** Buffs, debuffs e ailments dos participantes */
+	FStatusEffectSystem StatusEffects;
+
+	/**
+	 * Memória transitória da batalha (ordem de turnos, buffers de status...)
+	 * Ativo durante as funções de controle; volta ao início no EndCombat.
+	 */
+	FBattleArena Arena;
+
+	/** Buffer reutilizado pelo tick de status (no arena) */
+	FBattleIndexArray PoisonedParticipants;
+
+	/** Ordem de turnos em índices de participante, por AGI (no arena) */
+	FBattleIndexArray TurnOrder;
+
+private:
+	typedef FAttackResult (ACombatManager::*FCalculateDamageFn)(AActor*, AActor*, const FSkillData&);
+
+	/** Pipeline de dano instanciado para uma política de DamageFormulas.h */
+	template<typename TFormula>
+	FAttackResult CalculateDamageWithFormula(AActor* Attacker, AActor* Defender, const FSkillData& Skill);
+
+	/** Entradas do pipeline de dano lidas dos combatentes e do sistema de status */
+	FDamageInput MakeDamageInput(AActor* Attacker, AActor* Defender, const FSkillData& Skill) const;
+
+	/** Instanciação escolhida por DamageFormula (trocada só no StartCombat) */
+	FCalculateDamageFn CalculateDamageFn;
+
+	/** Seleciona CalculateDamageFn a partir de DamageFormula */
+	void SelectDamageFormula();
+
+	/** Busca o UCombatantComponent de cada participante uma única vez */
+	void CacheParticipantCombatants();
+
+	/** Todos os participantes do lado estão mortos (ou o lado está vazio)? */
+	bool IsSideDefeated(const TArray<AActor*>& Side) const;
+
+	/** AGI médio dos participantes ativos de um lado, em milésimos de ponto (para fuga) */
+	int32 GetAverageAgility(const TArray<AActor*>& Side) const;
+
+	/** Combatentes na mesma indexação de GetParticipantIndex */
+	UPROPERTY(Transient)
+	TArray<UCombatantComponent*> ParticipantCombatants;
+
+	/** Dispara o evento no barramento nativo e, se houver algo ligado, no delegate dinâmico */
+	void BroadcastCombatStarted();
+	void BroadcastCombatEnded(ECombatState EndState);
+	void BroadcastTurnChanged(bool bIsPlayerTurn);
+	void BroadcastDamageDealt(AActor* Target, const FAttackResult& Result);
+	void BroadcastNegotiationEnded(AActor* Demon, ENegotiationOutcome Outcome);
+
+	/** Barramento de eventos nativo */
+	FCombatEventBus EventBus;
+
+	/** Índice do participante na lista combinada (PlayerParty seguido de Enemies), ou INDEX_NONE */
+	int32 GetParticipantIndex(const AActor* Participant) const;
+
+	/** Retorna o participante pelo índice combinado */
+	AActor* GetParticipantByIndex(int32 Index) const;
+
+	/** Callback da notificação nativa de stats dos participantes */
+	void HandleParticipantStatsChanged(AActor* Participant);
+
+	/** Inscreve/remove o manager nas notificações de stats dos participantes */
+	void BindParticipantStatEvents();
+	void UnbindParticipantStatEvents();
+
+	/** Um bit por participante (mesma indexação de GetParticipantIndex); inline até 128 participantes */
+	TBitArray<> DirtyParticipants;
+
+	/** Inimigos criados por StartEncounter (destruídos no EndCombat) */
+	UPROPERTY(Transient)
+	TArray<AActor*> SpawnedEnemies;
 };
@@ -0,0 +1,95 @@
+// CombatMath.h
+// Aritmética inteira (em permilagem) das fórmulas de combate
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+
+/**
+ * Matemática determinística do combate
+ * Multiplicadores e chances são inteiros em permilagem (1000 = 100% / x1.0)
+ * e as rolagens usam só os bits do FRandomStream, sem float. O mesmo seed
+ * gera o mesmo resultado em qualquer compilador/plataforma (replays, lockstep,
+ * simulação em lote).
+ */
+struct FCombatMath
+{
+	/** 100% / x1.0 */
+	static constexpr int32 One = 1000;
+
+	/** Value * Permille / 1000, truncado em direção a zero (64 bits no meio) */
+	static constexpr int32 ApplyPermille(int32 Value, int32 Permille)
+	{
+		return (int32)((int64)Value * Permille / One);
+	}
+
+	/** Compõe dois multiplicadores em permilagem */
+	static constexpr int32 MulPermille(int32 A, int32 B)
+	{
+		return ApplyPermille(A, B);
+	}
+
+	/** Converte um valor editável em porcentagem (0-100, float de asset) para permilagem */
+	static FORCEINLINE int32 PercentToPermille(float Percent)
+	{
+		return FMath::RoundToInt(Percent * 10.0f);
+	}
+
+	/** Inteiro uniforme em [Min, Max] usando só aritmética inteira */
+	static FORCEINLINE int32 RandRange(const FRandomStream& Random, int32 Min, int32 Max)
+	{
+		const uint32 Range = (uint32)(Max - Min) + 1u;
+		return Min + (int32)(Random.GetUnsignedInt() % Range);
+	}
+
+	/** Rolagem em [0, 999] */
+	static FORCEINLINE int32 RollPermille(const FRandomStream& Random)
+	{
+		return (int32)(Random.GetUnsignedInt() % (uint32)One);
+	}
+
+	/** Passa no teste de ChancePermille? */
+	static FORCEINLINE bool Chance(const FRandomStream& Random, int32 ChancePermille)
+	{
+		return RollPermille(Random) < ChancePermille;
+	}
+
+	/** Multiplicador de afinidade (negativo = não fere o alvo: reflete ou cura) */
+	static constexpr int32 GetAffinityPermille(EElementAffinity Affinity)
+	{
+		switch (Affinity)
+		{
+		case EElementAffinity::Weak:   return 2000;
+		case EElementAffinity::Resist: return 500;
+		case EElementAffinity::Null:   return 0;
+		case EElementAffinity::Repel:  return -1000;  // Dano refletido
+		case EElementAffinity::Drain:  return -1000;  // Cura em vez de dano
+		default:                       return One;
+		}
+	}
+
+	/** Crítico */
+	static constexpr int32 CriticalPermille = 1500;
+
+	/** Variação do dano base (0.9 - 1.1) */
+	static constexpr int32 MinDamageVariance = 900;
+	static constexpr int32 MaxDamageVariance = 1100;
+
+	/**
+	 * Ordem de ação de uma rodada, a mesma no ACombatManager e no simulador:
+	 * índices de participante (party primeiro, depois inimigos) por AGI, maior
+	 * primeiro; empates mantêm a ordem dos índices. Quem está morto ou saiu do
+	 * combate perde a vez quando ela chega, não sai da ordem.
+	 */
+	template<typename TOrderArray, typename TGetAgility>
+	static void BuildTurnOrder(TOrderArray& OutOrder, int32 NumParticipants, TGetAgility GetAgility)
+	{
+		OutOrder.SetNumUninitialized(NumParticipants);
+		for (int32 i = 0; i < NumParticipants; i++)
+		{
+			OutOrder[i] = i;
+		}
+		OutOrder.StableSort([&GetAgility](int32 A, int32 B) { return GetAgility(A) > GetAgility(B); });
+	}
+};
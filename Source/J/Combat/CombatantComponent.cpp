@@ -0,0 +1,68 @@
+// CombatantComponent.cpp
+
+#include "CombatantComponent.h"
+#include "ProgressionSystem.h"
+
+UCombatantComponent::UCombatantComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UCombatantComponent::ModifyHP(int32 Delta)
+{
+	const int32 NewHP = FMath::Clamp(Stats.CurrentHP + Delta, 0, Stats.MaxHP);
+	if (NewHP != Stats.CurrentHP)
+	{
+		Stats.CurrentHP = NewHP;
+		OnStatsChanged.Broadcast(GetOwner());
+	}
+}
+
+void UCombatantComponent::ModifyMP(int32 Delta)
+{
+	const int32 NewMP = FMath::Clamp(Stats.CurrentMP + Delta, 0, Stats.MaxMP);
+	if (NewMP != Stats.CurrentMP)
+	{
+		Stats.CurrentMP = NewMP;
+		OnStatsChanged.Broadcast(GetOwner());
+	}
+}
+
+int32 UCombatantComponent::AddExperience(int32 Amount)
+{
+	if (Amount <= 0)
+	{
+		return 0;
+	}
+
+	Experience += Amount;
+
+	const int32 OldLevel = Stats.Level;
+	const int32 NewLevel = FProgression::GetLevelForExp(Experience, OldLevel);
+	if (NewLevel > OldLevel)
+	{
+		FProgression::ApplyLevelGrowth(Stats, Growth, OldLevel, NewLevel);
+		OnStatsChanged.Broadcast(GetOwner());
+	}
+	return NewLevel - OldLevel;
+}
+
+void UCombatantComponent::RestoreFull()
+{
+	Stats.CurrentHP = Stats.MaxHP;
+	Stats.CurrentMP = Stats.MaxMP;
+	OnStatsChanged.Broadcast(GetOwner());
+}
+
+void UCombatantComponent::SetStats(const FCharacterStats& NewStats)
+{
+	Stats = NewStats;
+	Stats.CurrentHP = FMath::Clamp(Stats.CurrentHP, 0, Stats.MaxHP);
+	Stats.CurrentMP = FMath::Clamp(Stats.CurrentMP, 0, Stats.MaxMP);
+	OnStatsChanged.Broadcast(GetOwner());
+}
+
+UCombatantComponent* UCombatantComponent::FindCombatant(const AActor* Actor)
+{
+	return Actor ? Actor->FindComponentByClass<UCombatantComponent>() : nullptr;
+}
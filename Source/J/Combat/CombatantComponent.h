@@ -0,0 +1,106 @@
+// CombatantComponent.h
+// Componente compartilhado por tudo que participa de combate (party e inimigos)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Core/RPGTypes.h"
+#include "CombatantComponent.generated.h"
+
+/**
+ * Stats e afinidades de um combatente
+ * Usado tanto pelos membros da party (AFirstPersonRPGCharacter) quanto pelos
+ * inimigos (AEnemyBase). Os acessores são inline e não-virtuais: o
+ * ACombatManager guarda ponteiros para estes componentes no início do combate
+ * e lê os stats diretamente a cada ação.
+ */
+UCLASS(ClassGroup=(RPG), meta=(BlueprintSpawnableComponent))
+class J_API UCombatantComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCombatantComponent();
+
+	// ==================== DADOS ====================
+
+	/** Estatísticas do combatente */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combatant")
+	FCharacterStats Stats;
+
+	/** Afinidades elementais */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combatant")
+	FElementAffinities Affinities;
+
+	/** Crescimento de stats ao subir de nível */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combatant")
+	FStatGrowth Growth;
+
+	/** EXP acumulado */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combatant")
+	int32 Experience = 0;
+
+	/** Skills que o combatente pode usar */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combatant")
+	TArray<FSkillData> Skills;
+
+	/** Disparado sempre que HP/MP mudam (nativo, sem custo de reflexão) */
+	FOnRPGStatsChanged OnStatsChanged;
+
+	// ==================== ACESSO RÁPIDO ====================
+
+	FORCEINLINE const FCharacterStats& GetStats() const { return Stats; }
+	FORCEINLINE int32 GetStrength() const { return Stats.Strength; }
+	FORCEINLINE int32 GetMagic() const { return Stats.Magic; }
+	FORCEINLINE int32 GetVitality() const { return Stats.Vitality; }
+	FORCEINLINE int32 GetAgility() const { return Stats.Agility; }
+	FORCEINLINE int32 GetLuck() const { return Stats.Luck; }
+
+	/** Stat de ataque para o elemento (STR para físico, MAG para o resto) */
+	FORCEINLINE int32 GetAttackStat(ERPGElement Element) const
+	{
+		return Element == ERPGElement::Physical ? Stats.Strength : Stats.Magic;
+	}
+
+	/** Stat de defesa para o elemento (VIT para físico, MAG para o resto) */
+	FORCEINLINE int32 GetDefenseStat(ERPGElement Element) const
+	{
+		return Element == ERPGElement::Physical ? Stats.Vitality : Stats.Magic;
+	}
+
+	// ==================== FUNÇÕES ====================
+
+	/** Verifica se está morto */
+	UFUNCTION(BlueprintPure, Category = "Combatant")
+	bool IsDead() const { return Stats.CurrentHP <= 0; }
+
+	/** Soma Delta ao HP (negativo = dano), limitado a [0, MaxHP] */
+	UFUNCTION(BlueprintCallable, Category = "Combatant")
+	void ModifyHP(int32 Delta);
+
+	/** Soma Delta ao MP, limitado a [0, MaxMP] */
+	UFUNCTION(BlueprintCallable, Category = "Combatant")
+	void ModifyMP(int32 Delta);
+
+	/** Procura uma skill pelo ID (nullptr se não conhecer) */
+	const FSkillData* FindSkill(FName SkillID) const
+	{
+		return Skills.FindByPredicate([SkillID](const FSkillData& Skill) { return Skill.SkillID == SkillID; });
+	}
+
+	/** Soma EXP e aplica os níveis ganhos; retorna quantos níveis subiu */
+	UFUNCTION(BlueprintCallable, Category = "Combatant")
+	int32 AddExperience(int32 Amount);
+
+	/** Restaura HP e MP ao máximo */
+	UFUNCTION(BlueprintCallable, Category = "Combatant")
+	void RestoreFull();
+
+	/** Troca todos os stats de uma vez (recarga de dados) e notifica */
+	void SetStats(const FCharacterStats& NewStats);
+
+	/** Retorna o combatente de um ator (ou nullptr) */
+	UFUNCTION(BlueprintPure, Category = "Combatant")
+	static UCombatantComponent* FindCombatant(const AActor* Actor);
+};
@@ -0,0 +1,451 @@
+// DamageFormulas.h
+// Fórmulas de dano base como políticas de template
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+#include "CombatMath.h"
+
+/**
+ * Entradas de um golpe, já lidas dos combatentes (ou das tabelas do simulador)
+ */
+struct FDamageInput
+{
+	int32 Power = 0;
+	int32 AccuracyPermille = FCombatMath::One;
+
+	/** Stats já escolhidos pelo elemento (STR/MAG e VIT/MAG) */
+	int32 AttackStat = 10;
+	int32 DefenseStat = 10;
+
+	int32 AttackerAgility = 10;
+	int32 DefenderAgility = 10;
+	int32 AttackerLuck = 10;
+	int32 DefenderLuck = 10;
+
+	/** Afinidades ao elemento do golpe (a do atacante só conta em Repel) */
+	EElementAffinity AttackerAffinity = EElementAffinity::Normal;
+	EElementAffinity DefenderAffinity = EElementAffinity::Normal;
+
+	/** Bônus de acerto do atacante menos evasão do defensor (permilagem) */
+	int32 HitBonus = 0;
+
+	/** Multiplicadores de status (permilagem) */
+	int32 AttackPermille = FCombatMath::One;
+	int32 AttackerTakenPermille = FCombatMath::One;
+	int32 DefenderTakenPermille = FCombatMath::One;
+};
+
+/**
+ * Resultado de um golpe
+ */
+struct FDamageOutcome
+{
+	int32 Damage = 0;
+	bool bHit = false;
+	bool bCritical = false;
+
+	/** Drain: Damage é cura no recipiente */
+	bool bHealed = false;
+
+	/** Repel: o recipiente é o atacante */
+	bool bReflected = false;
+};
+
+/** Um valor de dano e seu peso em FDamageDistribution::TotalWeight */
+struct FDamageBin
+{
+	int32 Damage = 0;
+	uint32 Weight = 0;
+};
+
+/**
+ * Distribuição exata do dano de um golpe (ver FDamageFormulas::Distribution)
+ * As rolagens são inteiras e uniformes (acerto e crítico em 1000 valores,
+ * variação em 201), então cada resultado tem um peso inteiro e as
+ * probabilidades são frações exatas de TotalWeight (desprezando o viés do
+ * módulo de FCombatMath, abaixo de 1e-6).
+ */
+struct FDamageDistribution
+{
+	static constexpr int32 NumVariances = FCombatMath::MaxDamageVariance - FCombatMath::MinDamageVariance + 1;
+
+	/** Acerto x variação x crítico */
+	static constexpr int64 TotalWeight = (int64)FCombatMath::One * NumVariances * FCombatMath::One;
+
+	/** Pior caso antes da fusão: bin 0 + uma sequência normal e uma crítica de NumVariances cada */
+	static constexpr int32 MaxBins = 1 + 2 * NumVariances;
+
+	int32 HitChancePermille = 0;
+
+	/** 0 quando o golpe não tem efeito (Null) */
+	int32 CritChancePermille = 0;
+
+	/** Mesmo significado de FDamageOutcome (não dependem das rolagens) */
+	bool bHealed = false;
+	bool bReflected = false;
+
+	/**
+	 * Danos distintos em ordem crescente; o bin 0 soma erro e Null
+	 * Inline no tamanho do pior caso (~3 KB): nenhuma distribuição vai ao heap,
+	 * mas a struct é para a pilha, não para guardar em arrays.
+	 */
+	TArray<FDamageBin, TInlineAllocator<MaxBins>> Bins;
+
+	void Reset()
+	{
+		HitChancePermille = 0;
+		CritChancePermille = 0;
+		bHealed = false;
+		bReflected = false;
+		Bins.Reset();
+	}
+
+	double GetProbability(int32 BinIndex) const { return (double)Bins[BinIndex].Weight / TotalWeight; }
+
+	/** Média contando erros como 0 */
+	double GetExpectedDamage() const
+	{
+		int64 Sum = 0;
+		for (const FDamageBin& Bin : Bins)
+		{
+			Sum += (int64)Bin.Damage * Bin.Weight;
+		}
+		return (double)Sum / TotalWeight;
+	}
+
+	/** Média dado que acertou */
+	double GetExpectedDamageOnHit() const
+	{
+		return HitChancePermille > 0 ? GetExpectedDamage() * FCombatMath::One / HitChancePermille : 0.0;
+	}
+
+	/** Probabilidade de causar pelo menos Threshold (> 0) */
+	double GetChanceAtLeast(int32 Threshold) const
+	{
+		int64 Sum = 0;
+		for (int32 i = Bins.Num() - 1; i >= 0 && Bins[i].Damage >= Threshold; i--)
+		{
+			Sum += Bins[i].Weight;
+		}
+		return (double)Sum / TotalWeight;
+	}
+
+	/** Menor e maior dano positivo (0 se o golpe nunca tem efeito) */
+	int32 GetMinDamage() const
+	{
+		for (const FDamageBin& Bin : Bins)
+		{
+			if (Bin.Damage > 0)
+			{
+				return Bin.Damage;
+			}
+		}
+		return 0;
+	}
+
+	int32 GetMaxDamage() const { return Bins.Num() > 0 ? Bins.Last().Damage : 0; }
+};
+
+/**
+ * Políticas de fórmula de dano
+ * Cada política é um tipo com uma função estática constexpr; o combate e os
+ * kernels em lote são instanciados uma vez por política, então o laço interno
+ * não tem dispatch virtual nem switch. A escolha em tempo de execução acontece
+ * uma única vez (por batalha) via FDamageFormulas::Dispatch.
+ *
+ * Entradas: Power = BasePower da skill, Attack/Defense = stats já escolhidos
+ * pelo elemento, Variance = variação em permilagem (900-1100). Tudo inteiro.
+ */
+struct FDamageFormulas
+{
+	/** Raiz quadrada inteira (arredondada para baixo) */
+	static constexpr int64 ISqrt(int64 Value)
+	{
+		if (Value < 2)
+		{
+			return Value < 0 ? 0 : Value;
+		}
+
+		int64 X = Value;
+		int64 Y = (X + 1) / 2;
+		while (Y < X)
+		{
+			X = Y;
+			Y = (X + Value / X) / 2;
+		}
+		return X;
+	}
+
+	static constexpr int32 AtLeastOne(int64 Value)
+	{
+		return Value < 1 ? 1 : (int32)Value;
+	}
+
+	/**
+	 * Pipeline completo de um golpe com a política TFormula
+	 * Estágios: acerto -> dano base -> afinidade (Repel redireciona ao atacante) -> crítico -> modificadores.
+	 * As rolagens saem de Random sempre na mesma ordem (acerto, variação, crítico).
+	 */
+	template<typename TFormula>
+	static FDamageOutcome Resolve(const FDamageInput& Input, const FRandomStream& Random);
+
+	/**
+	 * Distribuição exata do que Resolve<TFormula> pode devolver para Input
+	 * Percorre as 201 variações (normal e crítico) com os mesmos estágios de
+	 * Resolve, sem RNG: ~400 avaliações da fórmula, barato o bastante para
+	 * recalcular a cada alvo sob o cursor. Out é reutilizável.
+	 */
+	template<typename TFormula>
+	static void Distribution(const FDamageInput& Input, FDamageDistribution& Out);
+
+	// ==================== ESTÁGIOS (compartilhados por Resolve e Distribution) ====================
+
+	/** Chance de acerto: +1% por ponto de AGI de vantagem, -kaja/-nda em HitBonus */
+	static int32 GetHitChance(const FDamageInput& Input)
+	{
+		return FMath::Clamp(Input.AccuracyPermille + (Input.AttackerAgility - Input.DefenderAgility) * 10 + Input.HitBonus,
+			50, FCombatMath::One);
+	}
+
+	/** Chance de crítico (LUK): 5% base, +0.5% por ponto acima do defensor */
+	static int32 GetCritChance(const FDamageInput& Input)
+	{
+		return FMath::Clamp(50 + (Input.AttackerLuck - Input.DefenderLuck) * 5, 10, 500);
+	}
+
+	/**
+	 * Afinidade. Repel: o golpe volta para o atacante e usa a afinidade dele;
+	 * um golpe refletido não é refletido de novo (Repel do atacante conta como Null).
+	 * Preenche bReflected/bHealed e devolve o multiplicador absoluto (0 = Null).
+	 */
+	static int32 ResolveAffinity(const FDamageInput& Input, FDamageOutcome& Outcome, int32& OutTakenPermille)
+	{
+		int32 AffinityMult = FCombatMath::GetAffinityPermille(Input.DefenderAffinity);
+		OutTakenPermille = Input.DefenderTakenPermille;
+		if (Input.DefenderAffinity == EElementAffinity::Repel)
+		{
+			Outcome.bReflected = true;
+			OutTakenPermille = Input.AttackerTakenPermille;
+			AffinityMult = Input.AttackerAffinity == EElementAffinity::Repel
+				? 0 : FCombatMath::MulPermille(FMath::Abs(AffinityMult), FCombatMath::GetAffinityPermille(Input.AttackerAffinity));
+		}
+
+		// Multiplicador negativo restante = Drain: o dano vira cura
+		Outcome.bHealed = AffinityMult < 0;
+		return FMath::Abs(AffinityMult);
+	}
+
+	/** Status: buffs de quem ataca, defesa de quem recebe (cura ignora defesa) */
+	static int32 ApplyModifiers(int32 BaseDamage, int32 AffinityMult, const FDamageInput& Input, int32 TakenPermille, bool bHealed)
+	{
+		int32 Damage = FCombatMath::ApplyPermille(BaseDamage, AffinityMult);
+		Damage = FCombatMath::ApplyPermille(Damage, Input.AttackPermille);
+		Damage = FCombatMath::ApplyPermille(Damage, bHealed ? FCombatMath::One : TakenPermille);
+		return FMath::Max(1, Damage);
+	}
+
+	/**
+	 * Calcula o dano base de N golpes com a mesma política
+	 * Arrays em SoA, todos com o mesmo tamanho.
+	 */
+	template<typename TFormula>
+	static void ComputeBatch(TConstArrayView<int32> Power, TConstArrayView<int32> Attack, TConstArrayView<int32> Defense,
+		TConstArrayView<int32> Variance, TArrayView<int32> OutDamage)
+	{
+		check(Power.Num() == OutDamage.Num() && Attack.Num() == OutDamage.Num()
+			&& Defense.Num() == OutDamage.Num() && Variance.Num() == OutDamage.Num());
+
+		const int32 Num = OutDamage.Num();
+		for (int32 i = 0; i < Num; i++)
+		{
+			OutDamage[i] = TFormula::BaseDamage(Power[i], Attack[i], Defense[i], Variance[i]);
+		}
+	}
+
+	/**
+	 * Chama Functor(FPolitica()) com a política selecionada
+	 * Use para escolher uma instanciação uma vez e guardar o resultado
+	 * (ponteiro de função, lambda já especializado...).
+	 */
+	template<typename FunctorType>
+	static decltype(auto) Dispatch(EDamageFormula Formula, FunctorType&& Functor);
+};
+
+/** (Poder + Ataque) * variação - Defesa/2 (fórmula original do projeto) */
+struct FClassicDamageFormula
+{
+	static constexpr int32 BaseDamage(int32 Power, int32 Attack, int32 Defense, int32 Variance)
+	{
+		return FDamageFormulas::AtLeastOne((int64)FCombatMath::ApplyPermille(Power + Attack, Variance) - Defense / 2);
+	}
+};
+
+/** Estilo SMT I: subtrativa, ataque pesa em dobro e defesa inteira */
+struct FSMT1DamageFormula
+{
+	static constexpr int32 BaseDamage(int32 Power, int32 Attack, int32 Defense, int32 Variance)
+	{
+		return FDamageFormulas::AtLeastOne(FCombatMath::ApplyPermille(Power + Attack * 2 - Defense, Variance));
+	}
+};
+
+/** Estilo SMT III: Ataque * Poder / 15, dividido por (1 + Defesa/100) */
+struct FSMT3DamageFormula
+{
+	static constexpr int32 BaseDamage(int32 Power, int32 Attack, int32 Defense, int32 Variance)
+	{
+		const int64 Raw = (int64)Attack * Power / 15;
+		const int64 Reduced = Raw * 100 / (100 + (Defense > 0 ? Defense : 0));
+		return FDamageFormulas::AtLeastOne(FCombatMath::ApplyPermille((int32)Reduced, Variance));
+	}
+};
+
+/** Estilo Persona: 5 * raiz(Poder * Ataque / Defesa) */
+struct FPersonaDamageFormula
+{
+	static constexpr int32 BaseDamage(int32 Power, int32 Attack, int32 Defense, int32 Variance)
+	{
+		// raiz(x * 100) = 10 * raiz(x), então 5 * raiz(x) = raiz(x * 100) / 2
+		const int64 Ratio = (int64)Power * Attack * 100 / (Defense > 1 ? Defense : 1);
+		return FDamageFormulas::AtLeastOne(FCombatMath::ApplyPermille((int32)(FDamageFormulas::ISqrt(Ratio) / 2), Variance));
+	}
+};
+
+// Conferidos em tempo de compilação (ataque básico de um personagem nível 1)
+static_assert(FClassicDamageFormula::BaseDamage(30, 10, 10, 1000) == 35, "Classic");
+static_assert(FSMT1DamageFormula::BaseDamage(30, 10, 10, 1000) == 40, "SMT1");
+static_assert(FSMT3DamageFormula::BaseDamage(30, 10, 10, 1000) == 18, "SMT3");
+static_assert(FPersonaDamageFormula::BaseDamage(30, 10, 10, 1000) == 27, "Persona");
+
+template<typename TFormula>
+FDamageOutcome FDamageFormulas::Resolve(const FDamageInput& Input, const FRandomStream& Random)
+{
+	FDamageOutcome Outcome;
+
+	// 1) Acerto
+	if (!FCombatMath::Chance(Random, GetHitChance(Input)))
+	{
+		return Outcome;
+	}
+	Outcome.bHit = true;
+
+	// 2) Dano base
+	const int32 Variance = FCombatMath::RandRange(Random, FCombatMath::MinDamageVariance, FCombatMath::MaxDamageVariance);
+	const int32 BaseDamage = TFormula::BaseDamage(Input.Power, Input.AttackStat, Input.DefenseStat, Variance);
+
+	// 3) Afinidade
+	int32 TakenPermille = FCombatMath::One;
+	int32 AffinityMult = ResolveAffinity(Input, Outcome, TakenPermille);
+	if (AffinityMult == 0)
+	{
+		// Null: acertou mas não teve efeito
+		return Outcome;
+	}
+
+	// 4) Crítico
+	if (FCombatMath::Chance(Random, GetCritChance(Input)))
+	{
+		Outcome.bCritical = true;
+		AffinityMult = FCombatMath::MulPermille(AffinityMult, FCombatMath::CriticalPermille);
+	}
+
+	// 5) Status
+	Outcome.Damage = ApplyModifiers(BaseDamage, AffinityMult, Input, TakenPermille, Outcome.bHealed);
+	return Outcome;
+}
+
+template<typename TFormula>
+void FDamageFormulas::Distribution(const FDamageInput& Input, FDamageDistribution& Out)
+{
+	Out.Reset();
+
+	constexpr uint32 One = (uint32)FCombatMath::One;
+	const uint32 HitChance = (uint32)GetHitChance(Input);
+	Out.HitChancePermille = (int32)HitChance;
+
+	FDamageOutcome Flags;
+	int32 TakenPermille = FCombatMath::One;
+	const int32 AffinityMult = ResolveAffinity(Input, Flags, TakenPermille);
+	Out.bHealed = Flags.bHealed;
+	Out.bReflected = Flags.bReflected;
+
+	// Erro (e Null, que acerta sem efeito) somam no bin 0
+	const uint32 VariancesTimesCrit = (uint32)FDamageDistribution::NumVariances * One;
+	const uint32 ZeroWeight = (One - HitChance) * VariancesTimesCrit + (AffinityMult == 0 ? HitChance * VariancesTimesCrit : 0);
+	if (ZeroWeight > 0)
+	{
+		Out.Bins.Add({ 0, ZeroWeight });
+	}
+	if (AffinityMult == 0 || HitChance == 0)
+	{
+		return;
+	}
+
+	const uint32 CritChance = (uint32)GetCritChance(Input);
+	Out.CritChancePermille = (int32)CritChance;
+
+	// Peso de cada variação: P(acerto) x P(crítico ou não), no denominador comum
+	const uint32 NormalWeight = HitChance * (One - CritChance);
+	const uint32 CriticalWeight = HitChance * CritChance;
+	const int32 CriticalMult = FCombatMath::MulPermille(AffinityMult, FCombatMath::CriticalPermille);
+
+	// Dano é monótono na variação: valores iguais chegam em sequência e viram um só bin
+	auto AddWeight = [&Out](int32 Damage, uint32 Weight)
+	{
+		if (Out.Bins.Num() > 0 && Out.Bins.Last().Damage == Damage)
+		{
+			Out.Bins.Last().Weight += Weight;
+		}
+		else
+		{
+			Out.Bins.Add({ Damage, Weight });
+		}
+	};
+
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		const bool bCritical = Pass == 1;
+		const uint32 Weight = bCritical ? CriticalWeight : NormalWeight;
+		if (Weight == 0)
+		{
+			continue;
+		}
+
+		for (int32 Variance = FCombatMath::MinDamageVariance; Variance <= FCombatMath::MaxDamageVariance; Variance++)
+		{
+			const int32 BaseDamage = TFormula::BaseDamage(Input.Power, Input.AttackStat, Input.DefenseStat, Variance);
+			AddWeight(ApplyModifiers(BaseDamage, bCritical ? CriticalMult : AffinityMult, Input, TakenPermille, Flags.bHealed), Weight);
+		}
+	}
+
+	// Juntar as sequências normal e crítica (que se sobrepõem) em uma só, crescente
+	Out.Bins.Sort([](const FDamageBin& A, const FDamageBin& B) { return A.Damage < B.Damage; });
+
+	int32 Write = 0;
+	for (int32 Read = 1; Read < Out.Bins.Num(); Read++)
+	{
+		if (Out.Bins[Read].Damage == Out.Bins[Write].Damage)
+		{
+			Out.Bins[Write].Weight += Out.Bins[Read].Weight;
+		}
+		else
+		{
+			Out.Bins[++Write] = Out.Bins[Read];
+		}
+	}
+	Out.Bins.SetNum(Write + 1, EAllowShrinking::No);
+}
+
+template<typename FunctorType>
+decltype(auto) FDamageFormulas::Dispatch(EDamageFormula Formula, FunctorType&& Functor)
+{
+	switch (Formula)
+	{
+	case EDamageFormula::SMT1:    return Functor(FSMT1DamageFormula());
+	case EDamageFormula::SMT3:    return Functor(FSMT3DamageFormula());
+	case EDamageFormula::Persona: return Functor(FPersonaDamageFormula());
+	default:                      return Functor(FClassicDamageFormula());
+	}
+}
@@ -1,62 +1,149 @@
 // EnemyBase.cpp
 
 #include "EnemyBase.h"
+#include "CombatantComponent.h"
+#include "CombatMath.h"
+#include "EnemyDatabaseSubsystem.h"
+#include "Engine/GameInstance.h"
 
 AEnemyBase::AEnemyBase()
 {
 	PrimaryActorTick.bCanEverTick = false;
+
+	Combatant = CreateDefaultSubobject<UCombatantComponent>(TEXT("Combatant"));
 }
 
 void AEnemyBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Linha recarregada a quente nesta sessão vale mais que o CDO
+	UGameInstance* GameInstance = GetGameInstance();
+	if (UEnemyDatabaseSubsystem* EnemyDatabase = GameInstance ? GameInstance->GetSubsystem<UEnemyDatabaseSubsystem>() : nullptr)
+	{
+		DatabaseIndex = EnemyDatabase->GetDatabase().FindByClassPath(FName(*GetClass()->GetPathName()));
+		if (EnemyDatabase->WasRecordReloaded(DatabaseIndex))
+		{
+			ApplyDatabaseRecord(EnemyDatabase->GetDatabase(), DatabaseIndex);
+		}
+		EnemyDatabase->OnDatabaseUpdated.AddUObject(this, &AEnemyBase::HandleDatabaseUpdated);
+	}
 	
 	// Garantir HP cheio no início
-	Stats.CurrentHP = Stats.MaxHP;
-	Stats.CurrentMP = Stats.MaxMP;
+	Combatant->RestoreFull();
+}
+
+void AEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UGameInstance* GameInstance = GetGameInstance();
+	if (UEnemyDatabaseSubsystem* EnemyDatabase = GameInstance ? GameInstance->GetSubsystem<UEnemyDatabaseSubsystem>() : nullptr)
+	{
+		EnemyDatabase->OnDatabaseUpdated.RemoveAll(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AEnemyBase::HandleDatabaseUpdated(const FEnemyDatabase& Database, const FEnemyDatabaseDiff& Diff)
+{
+	// Índices só mudam numa troca completa; um arquétipo novo pode ter acabado de ser assado
+	if (Diff.bFullReload || DatabaseIndex == INDEX_NONE)
+	{
+		DatabaseIndex = Database.FindByClassPath(FName(*GetClass()->GetPathName()));
+	}
+
+	if (DatabaseIndex != INDEX_NONE
+		&& (Diff.bFullReload || Diff.ChangedRecords.Contains(DatabaseIndex) || Diff.AddedRecords.Contains(DatabaseIndex)))
+	{
+		ApplyDatabaseRecord(Database, DatabaseIndex);
+		UE_LOG(LogTemp, Log, TEXT("%s: Dados recarregados do banco"), *EnemyName.ToString());
+	}
 }
 
-void AEnemyBase::ApplyRPGDamage(int32 Amount, ERPGElement Element)
+void AEnemyBase::ApplyDatabaseRecord(const FEnemyDatabase& Database, int32 Index)
+{
+	const FEnemyRecord& Record = Database.GetRecord(Index);
+
+	// HP/MP atuais na mesma proporção do novo máximo (recarregar não cura nem derruba)
+	const FCharacterStats& OldStats = Combatant->GetStats();
+	FCharacterStats NewStats = OldStats;
+	NewStats.Level = Record.Level;
+	NewStats.MaxHP = Record.MaxHP;
+	NewStats.MaxMP = Record.MaxMP;
+	NewStats.Strength = Record.Strength;
+	NewStats.Magic = Record.Magic;
+	NewStats.Vitality = Record.Vitality;
+	NewStats.Agility = Record.Agility;
+	NewStats.Luck = Record.Luck;
+	NewStats.CurrentHP = OldStats.MaxHP > 0 ? (int32)((int64)OldStats.CurrentHP * Record.MaxHP / OldStats.MaxHP) : Record.MaxHP;
+	NewStats.CurrentMP = OldStats.MaxMP > 0 ? (int32)((int64)OldStats.CurrentMP * Record.MaxMP / OldStats.MaxMP) : Record.MaxMP;
+
+	Combatant->Affinities = FEnemyDatabase::UnpackAffinities(Record.PackedAffinities);
+
+	// Números do banco; nome e descrição das skills que o ator já tinha
+	TArray<FSkillData> Skills;
+	for (uint16 SkillIndex : Database.GetSkillIndices(Index))
+	{
+		const FSkillData* Known = Combatant->FindSkill(Database.GetSkillID(SkillIndex));
+		FSkillData& Skill = Skills.Add_GetRef(Known ? *Known : Database.MakeSkillData(SkillIndex));
+		Database.ApplySkillRecord(SkillIndex, Skill);
+	}
+	Combatant->Skills = MoveTemp(Skills);
+
+	Race = (EDemonRace)Record.Race;
+	Personality = (EDemonPersonality)Record.Personality;
+	ExperienceReward = Record.ExperienceReward;
+	GoldReward = Record.GoldReward;
+	ItemDropChance = Record.DropChancePermille / 10.0f;
+	DropItem = Database.GetDropItem(Index);
+
+	// Por último: o aviso de stats chega com afinidades e skills já atualizadas
+	Combatant->SetStats(NewStats);
+}
+
+void AEnemyBase::ApplyRPGDamage(int32 Amount, ERPGElement Element, AActor* DamageInstigator)
 {
 	EElementAffinity Affinity = GetElementAffinity(Element);
 	
-	int32 FinalDamage = Amount;
+	// Mesma tabela (inteira) do pipeline de combate; o sinal indica reflexão/absorção
+	int32 FinalDamage = FCombatMath::ApplyPermille(Amount, FMath::Abs(FCombatMath::GetAffinityPermille(Affinity)));
 	
 	switch (Affinity)
 	{
 	case EElementAffinity::Weak:
-		FinalDamage = Amount * 2;
 		UE_LOG(LogTemp, Log, TEXT("%s: Fraqueza! Dano dobrado (%d)"), *EnemyName.ToString(), FinalDamage);
 		break;
 		
 	case EElementAffinity::Resist:
-		FinalDamage = Amount / 2;
 		UE_LOG(LogTemp, Log, TEXT("%s: Resistência! Dano reduzido (%d)"), *EnemyName.ToString(), FinalDamage);
 		break;
 		
 	case EElementAffinity::Null:
-		FinalDamage = 0;
 		UE_LOG(LogTemp, Log, TEXT("%s: Nulo! Sem dano"), *EnemyName.ToString());
 		break;
 		
 	case EElementAffinity::Drain:
-		Heal(Amount);
-		UE_LOG(LogTemp, Log, TEXT("%s: Absorve! Curou %d"), *EnemyName.ToString(), Amount);
+		Heal(FinalDamage);
+		UE_LOG(LogTemp, Log, TEXT("%s: Absorve! Curou %d"), *EnemyName.ToString(), FinalDamage);
 		return;
 		
 	case EElementAffinity::Repel:
-		UE_LOG(LogTemp, Log, TEXT("%s: Reflete! (TODO: refletir dano)"), *EnemyName.ToString());
-		// TODO: Refletir dano de volta
+		// Dano refletido não é refletido de novo
+		if (UCombatantComponent* InstigatorCombatant = UCombatantComponent::FindCombatant(DamageInstigator))
+		{
+			InstigatorCombatant->ModifyHP(-FinalDamage);
+		}
+		UE_LOG(LogTemp, Log, TEXT("%s: Reflete! %d de dano em %s"), *EnemyName.ToString(), FinalDamage, *GetNameSafe(DamageInstigator));
 		return;
 		
 	default:
 		break;
 	}
 	
-	Stats.CurrentHP = FMath::Max(0, Stats.CurrentHP - FinalDamage);
+	Combatant->ModifyHP(-FinalDamage);
 	
 	UE_LOG(LogTemp, Log, TEXT("%s: Recebeu %d de dano. HP: %d/%d"), 
-		*EnemyName.ToString(), FinalDamage, Stats.CurrentHP, Stats.MaxHP);
+		*EnemyName.ToString(), FinalDamage, Combatant->Stats.CurrentHP, Combatant->Stats.MaxHP);
 	
 	if (IsDead())
 	{
@@ -67,46 +154,61 @@ void AEnemyBase::ApplyRPGDamage(int32 Amount, ERPGElement Element)
 
 void AEnemyBase::Heal(int32 Amount)
 {
-	Stats.CurrentHP = FMath::Min(Stats.MaxHP, Stats.CurrentHP + Amount);
+	Combatant->ModifyHP(Amount);
 	UE_LOG(LogTemp, Log, TEXT("%s: Curou %d. HP: %d/%d"), 
-		*EnemyName.ToString(), Amount, Stats.CurrentHP, Stats.MaxHP);
+		*EnemyName.ToString(), Amount, Combatant->Stats.CurrentHP, Combatant->Stats.MaxHP);
+}
+
+bool AEnemyBase::IsDead() const
+{
+	return Combatant->IsDead();
 }
 
 EElementAffinity AEnemyBase::GetElementAffinity(ERPGElement Element) const
 {
-	return Affinities.GetAffinity(Element);
+	return Combatant->Affinities.GetAffinity(Element);
 }
 
-FSkillData AEnemyBase::SelectAction_Implementation()
+FSkillData AEnemyBase::SelectAction_Implementation(int32 RandomSeed)
 {
 	// IA básica: selecionar skill aleatória se tiver MP, senão ataque básico
-	if (Skills.Num() > 0)
+	if (Combatant->Skills.Num() > 0)
 	{
-		// Filtrar skills que pode usar (tem MP suficiente)
-		TArray<FSkillData> UsableSkills;
-		for (const FSkillData& Skill : Skills)
+		// Sortear entre as skills que pode usar (tem MP suficiente) sem montar lista:
+		// conta as utilizáveis e depois anda até a sorteada
+		const int32 CurrentMP = Combatant->GetStats().CurrentMP;
+		int32 NumUsable = 0;
+		for (const FSkillData& Skill : Combatant->Skills)
 		{
-			if (Stats.CurrentMP >= Skill.MPCost)
-			{
-				UsableSkills.Add(Skill);
-			}
+			NumUsable += CurrentMP >= Skill.MPCost ? 1 : 0;
 		}
 		
-		if (UsableSkills.Num() > 0)
+		if (NumUsable > 0)
 		{
-			int32 RandomIndex = FMath::RandRange(0, UsableSkills.Num() - 1);
-			return UsableSkills[RandomIndex];
+			const FRandomStream Random(RandomSeed);
+			int32 Remaining = FCombatMath::RandRange(Random, 0, NumUsable - 1);
+			for (const FSkillData& Skill : Combatant->Skills)
+			{
+				if (CurrentMP >= Skill.MPCost && Remaining-- == 0)
+				{
+					return Skill;
+				}
+			}
 		}
 	}
 	
-	// Ataque básico como fallback
-	FSkillData BasicAttack;
-	BasicAttack.SkillID = FName("BasicAttack");
-	BasicAttack.DisplayName = FText::FromString("Attack");
-	BasicAttack.Element = ERPGElement::Physical;
-	BasicAttack.BasePower = 30;
-	BasicAttack.MPCost = 0;
-	BasicAttack.Accuracy = 90.0f;
+	// Ataque básico como fallback (montado uma vez: copiar o FText só divide a referência)
+	static const FSkillData BasicAttack = []()
+	{
+		FSkillData Attack;
+		Attack.SkillID = FName("BasicAttack");
+		Attack.DisplayName = NSLOCTEXT("Combat", "BasicAttack", "Attack");
+		Attack.Element = ERPGElement::Physical;
+		Attack.BasePower = 30;
+		Attack.MPCost = 0;
+		Attack.Accuracy = 90.0f;
+		return Attack;
+	}();
 	
 	return BasicAttack;
 }
@@ -6,8 +6,14 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/RPGTypes.h"
+#include "Negotiation/NegotiationTypes.h"
 #include "EnemyBase.generated.h"
 
+class UCombatantComponent;
+class UNegotiationGraphAsset;
+class FEnemyDatabase;
+struct FEnemyDatabaseDiff;
+
 /**
  * Classe base para todos os inimigos/demônios
  */
@@ -25,29 +31,33 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy")
 	FText EnemyName;
 
-	/** Descrição do inimigo */
+	/** ID no compêndio (descrição e metadados ficam no UDemonCompendiumAsset) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy")
+	FName DemonID;
+
+	/** Raça do demônio (fusão/compêndio) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy")
-	FText EnemyDescription;
+	EDemonRace Race = EDemonRace::Beast;
 
-	/** Ícone/Sprite do inimigo */
+	/** Ícone/Sprite do inimigo (carregado sob demanda) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy")
-	UTexture2D* EnemySprite;
+	TSoftObjectPtr<UTexture2D> EnemySprite;
 
 	// ==================== STATS ====================
 
-	/** Estatísticas do inimigo */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Enemy|Stats")
-	FCharacterStats Stats;
+	/** Stats, afinidades e skills do inimigo (mesmo componente usado pela party) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy|Stats")
+	UCombatantComponent* Combatant;
 
-	/** Afinidades elementais */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Enemy|Stats")
-	FElementAffinities Affinities;
+	// ==================== NEGOCIAÇÃO ====================
 
-	// ==================== HABILIDADES ====================
+	/** Personalidade usada na negociação (Talk) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|Negotiation")
+	EDemonPersonality Personality = EDemonPersonality::Childish;
 
-	/** Skills que o inimigo pode usar */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Enemy|Skills")
-	TArray<FSkillData> Skills;
+	/** Diálogo de negociação compartilhado pelo arquétipo (nullptr = não conversa) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|Negotiation")
+	UNegotiationGraphAsset* NegotiationGraph = nullptr;
 
 	// ==================== RECOMPENSAS ====================
 
@@ -63,11 +73,18 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Enemy|Rewards")
 	float ItemDropChance = 10.0f;
 
+	/** Item dropado (ver UItemDatabaseAsset) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Enemy|Rewards")
+	FName DropItem;
+
 	// ==================== FUNÇÕES ====================
 
-	/** Aplica dano ao inimigo */
+	/**
+	 * Aplica dano elemental fora do pipeline de combate (armadilhas, scripts...).
+	 * Drain cura; Repel devolve o dano a DamageInstigator, se houver.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Enemy")
-	void ApplyRPGDamage(int32 Amount, ERPGElement Element);
+	void ApplyRPGDamage(int32 Amount, ERPGElement Element, AActor* DamageInstigator = nullptr);
 
 	/** Cura o inimigo */
 	UFUNCTION(BlueprintCallable, Category = "Enemy")
@@ -75,16 +92,35 @@ public:
 
 	/** Verifica se está morto */
 	UFUNCTION(BlueprintPure, Category = "Enemy")
-	bool IsDead() const { return Stats.CurrentHP <= 0; }
+	bool IsDead() const;
 
 	/** Retorna a afinidade para um elemento */
 	UFUNCTION(BlueprintPure, Category = "Enemy")
 	EElementAffinity GetElementAffinity(ERPGElement Element) const;
 
-	/** Seleciona uma ação de IA */
+	/**
+	 * Seleciona uma ação de IA
+	 * RandomSeed é sorteado do BattleRandom do combate: todo sorteio da IA deve
+	 * sair de um FRandomStream com essa semente, para a batalha continuar
+	 * reproduzível pelo BattleSeed.
+	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Enemy|AI")
-	FSkillData SelectAction();
+	FSkillData SelectAction(int32 RandomSeed);
+
+	/**
+	 * Aplica uma linha do banco de inimigos (recarga a quente) sobre este ator
+	 * HP/MP atuais mantêm a proporção do máximo; skills conhecidas mantêm os textos.
+	 */
+	void ApplyDatabaseRecord(const FEnemyDatabase& Database, int32 Index);
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** Reaplica a linha deste arquétipo se ela mudou */
+	void HandleDatabaseUpdated(const FEnemyDatabase& Database, const FEnemyDatabaseDiff& Diff);
+
+	/** Linha do arquétipo no UEnemyDatabaseSubsystem (INDEX_NONE = não assado) */
+	int32 DatabaseIndex = INDEX_NONE;
 };
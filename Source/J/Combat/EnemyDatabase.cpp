@@ -0,0 +1,524 @@
+// EnemyDatabase.cpp
+
+#include "EnemyDatabase.h"
+#include "EnemyBase.h"
+#include "CombatantComponent.h"
+#include "CombatMath.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 EnemyDatabaseMagic = 0x4A454E4D; // "JENM"
+	/** 1: registros em bloco (com padding); 2: campo a campo */
+	constexpr uint32 EnemyDatabaseVersion = 2;
+
+	constexpr ERPGElement PackedElements[] = {
+		ERPGElement::Physical, ERPGElement::Fire, ERPGElement::Ice, ERPGElement::Electric,
+		ERPGElement::Wind, ERPGElement::Light, ERPGElement::Dark
+	};
+
+	uint32 PackAffinities(const FElementAffinities& Affinities)
+	{
+		uint32 Packed = 0;
+		for (ERPGElement Element : PackedElements)
+		{
+			Packed |= ((uint32)Affinities.GetAffinity(Element) & 0x7) << ((uint32)Element * 3);
+		}
+		return Packed;
+	}
+
+	/** Mesmos dados, sem contar a faixa de skills (comparação campo a campo: o padding não conta) */
+	bool SameRecordData(const FEnemyRecord& A, const FEnemyRecord& B)
+	{
+		return A.Level == B.Level && A.MaxHP == B.MaxHP && A.MaxMP == B.MaxMP
+			&& A.Strength == B.Strength && A.Magic == B.Magic && A.Vitality == B.Vitality && A.Agility == B.Agility && A.Luck == B.Luck
+			&& A.Race == B.Race && A.Personality == B.Personality && A.PackedAffinities == B.PackedAffinities
+			&& A.ExperienceReward == B.ExperienceReward && A.GoldReward == B.GoldReward && A.DropChancePermille == B.DropChancePermille;
+	}
+
+	bool SameSkill(const FEnemySkillRecord& A, const FEnemySkillRecord& B)
+	{
+		return A.BasePower == B.BasePower && A.MPCost == B.MPCost && A.AccuracyPermille == B.AccuracyPermille
+			&& A.StatusChancePermille == B.StatusChancePermille && A.EffectType == B.EffectType && A.Element == B.Element
+			&& A.StatusEffect == B.StatusEffect && A.StatusDuration == B.StatusDuration
+			&& A.bTargetsAll == B.bTargetsAll && A.bTargetsAllies == B.bTargetsAllies;
+	}
+
+	/** bool como 1 byte (o operator<< do FArchive grava 4) */
+	void SerializeFlag(FArchive& Ar, bool& bValue)
+	{
+		uint8 Byte = bValue ? 1 : 0;
+		Ar << Byte;
+		bValue = Byte != 0;
+	}
+
+	/** Campo a campo: bytes de padding nunca vão para o arquivo (o bake fica determinístico) */
+	void SerializeElement(FArchive& Ar, FEnemyRecord& Record)
+	{
+		Ar << Record.Level << Record.MaxHP << Record.MaxMP;
+		Ar << Record.Strength << Record.Magic << Record.Vitality << Record.Agility << Record.Luck;
+		Ar << Record.Race << Record.Personality << Record.PackedAffinities;
+		Ar << Record.ExperienceReward << Record.GoldReward << Record.DropChancePermille;
+		Ar << Record.FirstSkill << Record.NumSkills;
+	}
+
+	void SerializeElement(FArchive& Ar, FEnemySkillRecord& Skill)
+	{
+		Ar << Skill.BasePower << Skill.MPCost << Skill.AccuracyPermille << Skill.StatusChancePermille;
+		Ar << Skill.EffectType << Skill.Element << Skill.StatusEffect << Skill.StatusDuration;
+		SerializeFlag(Ar, Skill.bTargetsAll);
+		SerializeFlag(Ar, Skill.bTargetsAllies);
+	}
+
+	void SerializeElement(FArchive& Ar, uint16& Value)
+	{
+		Ar << Value;
+	}
+
+	/** Arrays POD: tamanho + elementos */
+	template<typename T>
+	void SerializeArray(FArchive& Ar, TArray<T>& Array)
+	{
+		int32 Num = Array.Num();
+		Ar << Num;
+		if (Ar.IsLoading())
+		{
+			// Cada elemento ocupa ao menos 2 bytes: barra tamanhos absurdos antes de alocar
+			if (Num < 0 || (int64)Num * 2 > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				return;
+			}
+			Array.SetNum(Num);
+		}
+
+		for (T& Element : Array)
+		{
+			SerializeElement(Ar, Element);
+		}
+	}
+}
+
+FString FEnemyDatabase::GetDefaultPath()
+{
+	return FPaths::ProjectContentDir() / TEXT("Data/EnemyDatabase.bin");
+}
+
+void FEnemyDatabase::Reset()
+{
+	Records.Reset();
+	DemonIDs.Reset();
+	ClassPaths.Reset();
+	DropItems.Reset();
+	SkillIndices.Reset();
+	Skills.Reset();
+	SkillIDs.Reset();
+	IndexByDemonID.Reset();
+	IndexByClassPath.Reset();
+	SkillIndexByID.Reset();
+}
+
+int32 FEnemyDatabase::AddArchetype(const AEnemyBase& EnemyDefaults)
+{
+	const FName ClassPath(*EnemyDefaults.GetClass()->GetPathName());
+	const int32* Existing = IndexByClassPath.Find(ClassPath);
+
+	FEnemyRecord Record = Existing ? Records[*Existing] : FEnemyRecord();
+	Record.Race = (uint8)EnemyDefaults.Race;
+	Record.Personality = (uint8)EnemyDefaults.Personality;
+	Record.ExperienceReward = EnemyDefaults.ExperienceReward;
+	Record.GoldReward = EnemyDefaults.GoldReward;
+	Record.DropChancePermille = (uint16)FMath::Clamp(FCombatMath::PercentToPermille(EnemyDefaults.ItemDropChance), 0, FCombatMath::One);
+
+	TArray<uint16, TInlineAllocator<16>> ArchetypeSkills;
+	if (const UCombatantComponent* Combatant = EnemyDefaults.Combatant)
+	{
+		const FCharacterStats& Stats = Combatant->GetStats();
+		Record.Level = Stats.Level;
+		Record.MaxHP = Stats.MaxHP;
+		Record.MaxMP = Stats.MaxMP;
+		Record.Strength = (int16)Stats.Strength;
+		Record.Magic = (int16)Stats.Magic;
+		Record.Vitality = (int16)Stats.Vitality;
+		Record.Agility = (int16)Stats.Agility;
+		Record.Luck = (int16)Stats.Luck;
+		Record.PackedAffinities = PackAffinities(Combatant->Affinities);
+
+		for (const FSkillData& Skill : Combatant->Skills)
+		{
+			ArchetypeSkills.Add(AddSkill(Skill));
+		}
+	}
+	else
+	{
+		Record.PackedAffinities = PackAffinities(FElementAffinities());
+	}
+	AssignSkillRange(Record, ArchetypeSkills);
+
+	// Arquétipo já assado: atualizar no lugar, o índice não muda
+	if (Existing)
+	{
+		const int32 Index = *Existing;
+		Records[Index] = Record;
+		DropItems[Index] = EnemyDefaults.DropItem;
+		if (DemonIDs[Index] != EnemyDefaults.DemonID)
+		{
+			IndexByDemonID.Remove(DemonIDs[Index]);
+			DemonIDs[Index] = EnemyDefaults.DemonID;
+			if (!EnemyDefaults.DemonID.IsNone())
+			{
+				IndexByDemonID.Add(EnemyDefaults.DemonID, Index);
+			}
+		}
+		return Index;
+	}
+
+	const int32 Index = Records.Add(Record);
+	DemonIDs.Add(EnemyDefaults.DemonID);
+	ClassPaths.Add(ClassPath);
+	DropItems.Add(EnemyDefaults.DropItem);
+
+	IndexByClassPath.Add(ClassPath, Index);
+	if (!EnemyDefaults.DemonID.IsNone())
+	{
+		IndexByDemonID.Add(EnemyDefaults.DemonID, Index);
+	}
+	return Index;
+}
+
+void FEnemyDatabase::AssignSkillRange(FEnemyRecord& Record, TConstArrayView<uint16> Indices)
+{
+	if (Record.NumSkills == Indices.Num()
+		&& (Indices.Num() == 0 || FMemory::Memcmp(SkillIndices.GetData() + Record.FirstSkill, Indices.GetData(), Indices.Num() * sizeof(uint16)) == 0))
+	{
+		return;
+	}
+
+	Record.FirstSkill = (uint16)SkillIndices.Num();
+	Record.NumSkills = (uint16)Indices.Num();
+	SkillIndices.Append(Indices.GetData(), Indices.Num());
+}
+
+int32 FEnemyDatabase::AddRecord(FName DemonID, const FEnemyRecord& Record)
+{
+	FEnemyRecord Copy = Record;
+	Copy.FirstSkill = (uint16)SkillIndices.Num();
+	Copy.NumSkills = 0;
+
+	const int32 Index = Records.Add(Copy);
+	DemonIDs.Add(DemonID);
+	ClassPaths.Add(NAME_None);
+	DropItems.Add(NAME_None);
+	if (!DemonID.IsNone())
+	{
+		IndexByDemonID.Add(DemonID, Index);
+	}
+	return Index;
+}
+
+uint16 FEnemyDatabase::AddSkill(const FSkillData& Skill)
+{
+	if (const uint16* Existing = SkillIndexByID.Find(Skill.SkillID))
+	{
+		return *Existing;
+	}
+
+	FEnemySkillRecord Record;
+	Record.BasePower = Skill.BasePower;
+	Record.MPCost = Skill.MPCost;
+	Record.AccuracyPermille = (uint16)FMath::Clamp(FCombatMath::PercentToPermille(Skill.Accuracy), 0, FCombatMath::One);
+	Record.StatusChancePermille = (uint16)FMath::Clamp(FCombatMath::PercentToPermille(Skill.StatusChance), 0, FCombatMath::One);
+	Record.EffectType = (uint8)Skill.EffectType;
+	Record.Element = (uint8)Skill.Element;
+	Record.StatusEffect = (uint8)Skill.StatusEffect;
+	Record.StatusDuration = (uint8)FMath::Clamp(Skill.StatusDuration, 0, 255);
+	Record.bTargetsAll = Skill.bTargetsAll;
+	Record.bTargetsAllies = Skill.bTargetsAllies;
+
+	const uint16 Index = (uint16)Skills.Add(Record);
+	SkillIDs.Add(Skill.SkillID);
+	SkillIndexByID.Add(Skill.SkillID, Index);
+	return Index;
+}
+
+FElementAffinities FEnemyDatabase::UnpackAffinities(uint32 PackedAffinities)
+{
+	FElementAffinities Affinities;
+	Affinities.Physical = UnpackAffinity(PackedAffinities, ERPGElement::Physical);
+	Affinities.Fire = UnpackAffinity(PackedAffinities, ERPGElement::Fire);
+	Affinities.Ice = UnpackAffinity(PackedAffinities, ERPGElement::Ice);
+	Affinities.Electric = UnpackAffinity(PackedAffinities, ERPGElement::Electric);
+	Affinities.Wind = UnpackAffinity(PackedAffinities, ERPGElement::Wind);
+	Affinities.Light = UnpackAffinity(PackedAffinities, ERPGElement::Light);
+	Affinities.Dark = UnpackAffinity(PackedAffinities, ERPGElement::Dark);
+	return Affinities;
+}
+
+FSkillData FEnemyDatabase::MakeSkillData(int32 SkillIndex) const
+{
+	FSkillData Skill;
+	Skill.SkillID = SkillIDs[SkillIndex];
+	ApplySkillRecord(SkillIndex, Skill);
+	return Skill;
+}
+
+void FEnemyDatabase::ApplySkillRecord(int32 SkillIndex, FSkillData& InOutSkill) const
+{
+	const FEnemySkillRecord& Record = Skills[SkillIndex];
+
+	InOutSkill.EffectType = (ESkillEffectType)Record.EffectType;
+	InOutSkill.Element = (ERPGElement)Record.Element;
+	InOutSkill.BasePower = Record.BasePower;
+	InOutSkill.MPCost = Record.MPCost;
+	InOutSkill.Accuracy = Record.AccuracyPermille / 10.0f;
+	InOutSkill.StatusEffect = (EStatusEffect)Record.StatusEffect;
+	InOutSkill.StatusDuration = Record.StatusDuration;
+	InOutSkill.StatusChance = Record.StatusChancePermille / 10.0f;
+	InOutSkill.bTargetsAll = Record.bTargetsAll;
+	InOutSkill.bTargetsAllies = Record.bTargetsAllies;
+}
+
+int32 FEnemyDatabase::FindByDemonID(FName DemonID) const
+{
+	const int32* Index = IndexByDemonID.Find(DemonID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FEnemyDatabase::FindByClassPath(FName ClassPath) const
+{
+	const int32* Index = IndexByClassPath.Find(ClassPath);
+	return Index ? *Index : INDEX_NONE;
+}
+
+// ==================== ARQUIVO ====================
+
+void FEnemyDatabase::SaveToBytes(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Magic = EnemyDatabaseMagic;
+	uint32 Version = EnemyDatabaseVersion;
+	Writer << Magic;
+	Writer << Version;
+
+	FEnemyDatabase& Self = const_cast<FEnemyDatabase&>(*this);
+	SerializeArray(Writer, Self.Records);
+	SerializeArray(Writer, Self.SkillIndices);
+	SerializeArray(Writer, Self.Skills);
+
+	// Nomes como texto (FMemoryWriter não usa a tabela de nomes)
+	Writer << Self.DemonIDs;
+	Writer << Self.ClassPaths;
+	Writer << Self.DropItems;
+	Writer << Self.SkillIDs;
+}
+
+bool FEnemyDatabase::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+	Reset();
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+
+	if (Reader.IsError() || Magic != EnemyDatabaseMagic || Version != EnemyDatabaseVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EnemyDatabase: Arquivo inválido ou de outra versão"));
+		return false;
+	}
+
+	SerializeArray(Reader, Records);
+	SerializeArray(Reader, SkillIndices);
+	SerializeArray(Reader, Skills);
+	Reader << DemonIDs;
+	Reader << ClassPaths;
+	Reader << DropItems;
+	Reader << SkillIDs;
+
+	bool bConsistent = DemonIDs.Num() == Records.Num() && ClassPaths.Num() == Records.Num()
+		&& DropItems.Num() == Records.Num() && SkillIDs.Num() == Skills.Num() && Skills.Num() <= MAX_uint16 + 1;
+
+	// Faixas de skill dentro de SkillIndices e índices dentro de Skills (o runtime não confere)
+	for (const FEnemyRecord& Record : Records)
+	{
+		bConsistent &= (int32)Record.FirstSkill + Record.NumSkills <= SkillIndices.Num();
+	}
+	for (uint16 SkillIndex : SkillIndices)
+	{
+		bConsistent &= SkillIndex < Skills.Num();
+	}
+
+	if (Reader.IsError() || !bConsistent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EnemyDatabase: Arquivo corrompido"));
+		Reset();
+		return false;
+	}
+
+	RebuildIndex();
+	return true;
+}
+
+bool FEnemyDatabase::SaveToFile(const FString& Path) const
+{
+	TArray<uint8> Bytes;
+	SaveToBytes(Bytes);
+	return FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FEnemyDatabase::LoadFromFile(const FString& Path)
+{
+	TArray<uint8> Bytes;
+	return FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent) && LoadFromBytes(Bytes);
+}
+
+// ==================== RECARGA ====================
+
+bool FEnemyDatabase::ApplyUpdate(const FEnemyDatabase& Source, FEnemyDatabaseDiff& OutDiff)
+{
+	OutDiff.Reset();
+
+	// Pior caso: todas as skills e todas as listas de skills do arquivo são novas
+	if (Skills.Num() + Source.Skills.Num() > MAX_uint16 || SkillIndices.Num() + Source.SkillIndices.Num() > MAX_uint16)
+	{
+		return false;
+	}
+
+	// 1) Skills, casadas pelo SkillID
+	TArray<uint16, TInlineAllocator<256>> SkillRemap;
+	SkillRemap.SetNumUninitialized(Source.Skills.Num());
+	TBitArray<> ChangedSkillBits(false, Skills.Num());
+
+	for (int32 i = 0; i < Source.Skills.Num(); i++)
+	{
+		const FName SkillID = Source.SkillIDs[i];
+		if (const uint16* Existing = SkillIndexByID.Find(SkillID))
+		{
+			SkillRemap[i] = *Existing;
+			if (!SameSkill(Skills[*Existing], Source.Skills[i]))
+			{
+				Skills[*Existing] = Source.Skills[i];
+				ChangedSkillBits[*Existing] = true;
+				OutDiff.ChangedSkills.Add(*Existing);
+			}
+		}
+		else
+		{
+			const uint16 Index = (uint16)Skills.Add(Source.Skills[i]);
+			SkillIDs.Add(SkillID);
+			SkillIndexByID.Add(SkillID, Index);
+			SkillRemap[i] = Index;
+			OutDiff.AddedSkills.Add(Index);
+		}
+	}
+
+	// 2) Registros, casados pela classe (ou DemonID)
+	TBitArray<> Seen(false, Records.Num());
+	TArray<uint16, TInlineAllocator<16>> RecordSkills;
+
+	for (int32 i = 0; i < Source.Records.Num(); i++)
+	{
+		const FName ClassPath = Source.ClassPaths[i];
+		const FName DemonID = Source.DemonIDs[i];
+		const int32 Local = !ClassPath.IsNone() ? FindByClassPath(ClassPath) : FindByDemonID(DemonID);
+
+		RecordSkills.Reset();
+		for (uint16 SourceSkill : Source.GetSkillIndices(i))
+		{
+			RecordSkills.Add(SkillRemap[SourceSkill]);
+		}
+
+		FEnemyRecord Record = Source.Records[i];
+		if (Local == INDEX_NONE)
+		{
+			Record.FirstSkill = 0;
+			Record.NumSkills = 0;
+			AssignSkillRange(Record, RecordSkills);
+
+			const int32 Index = Records.Add(Record);
+			DemonIDs.Add(DemonID);
+			ClassPaths.Add(ClassPath);
+			DropItems.Add(Source.DropItems[i]);
+			if (!ClassPath.IsNone())
+			{
+				IndexByClassPath.Add(ClassPath, Index);
+			}
+			if (!DemonID.IsNone())
+			{
+				IndexByDemonID.Add(DemonID, Index);
+			}
+			OutDiff.AddedRecords.Add(Index);
+			continue;
+		}
+
+		if (Seen.IsValidIndex(Local))
+		{
+			Seen[Local] = true;
+		}
+
+		FEnemyRecord& Current = Records[Local];
+		Record.FirstSkill = Current.FirstSkill;
+		Record.NumSkills = Current.NumSkills;
+		AssignSkillRange(Record, RecordSkills);
+
+		bool bChanged = !SameRecordData(Current, Record) || Record.FirstSkill != Current.FirstSkill || Record.NumSkills != Current.NumSkills
+			|| DemonIDs[Local] != DemonID || DropItems[Local] != Source.DropItems[i];
+
+		// Dependência: quem usa uma skill alterada também precisa ser reaplicado
+		for (uint16 SkillIndex : RecordSkills)
+		{
+			bChanged |= ChangedSkillBits.IsValidIndex(SkillIndex) && ChangedSkillBits[SkillIndex];
+		}
+
+		if (!bChanged)
+		{
+			continue;
+		}
+
+		if (DemonIDs[Local] != DemonID)
+		{
+			IndexByDemonID.Remove(DemonIDs[Local]);
+			if (!DemonID.IsNone())
+			{
+				IndexByDemonID.Add(DemonID, Local);
+			}
+			DemonIDs[Local] = DemonID;
+		}
+		Current = Record;
+		DropItems[Local] = Source.DropItems[i];
+		OutDiff.ChangedRecords.Add(Local);
+	}
+
+	OutDiff.NumRemovedRecords = Seen.Num() - Seen.CountSetBits();
+	return true;
+}
+
+void FEnemyDatabase::RebuildIndex()
+{
+	IndexByDemonID.Reset();
+	IndexByClassPath.Reset();
+	SkillIndexByID.Reset();
+
+	for (int32 i = 0; i < Records.Num(); i++)
+	{
+		if (!ClassPaths[i].IsNone())
+		{
+			IndexByClassPath.Add(ClassPaths[i], i);
+		}
+		if (!DemonIDs[i].IsNone())
+		{
+			IndexByDemonID.Add(DemonIDs[i], i);
+		}
+	}
+
+	for (int32 i = 0; i < Skills.Num(); i++)
+	{
+		SkillIndexByID.Add(SkillIDs[i], (uint16)i);
+	}
+}
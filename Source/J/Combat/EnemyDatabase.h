@@ -0,0 +1,208 @@
+// EnemyDatabase.h
+// Tabela plana com os arquétipos de inimigo, gerada a partir dos CDOs
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+
+class AEnemyBase;
+
+/**
+ * Stats e recompensas de um arquétipo (POD; gravado campo a campo, sem padding)
+ */
+struct FEnemyRecord
+{
+	int32 Level = 1;
+	int32 MaxHP = 1;
+	int32 MaxMP = 0;
+	int16 Strength = 0;
+	int16 Magic = 0;
+	int16 Vitality = 0;
+	int16 Agility = 0;
+	int16 Luck = 0;
+
+	/** EDemonRace / EDemonPersonality */
+	uint8 Race = 0;
+	uint8 Personality = 0;
+
+	/** 3 bits de EElementAffinity por ERPGElement (ver FEnemyDatabase::GetAffinity) */
+	uint32 PackedAffinities = 0;
+
+	int32 ExperienceReward = 0;
+	int32 GoldReward = 0;
+	uint16 DropChancePermille = 0;
+
+	/** Faixa em FEnemyDatabase::SkillIndices */
+	uint16 FirstSkill = 0;
+	uint16 NumSkills = 0;
+};
+
+/**
+ * Skill de inimigo já reduzida ao que o combate usa (POD)
+ */
+struct FEnemySkillRecord
+{
+	int32 BasePower = 0;
+	int32 MPCost = 0;
+	uint16 AccuracyPermille = 0;
+	uint16 StatusChancePermille = 0;
+	uint8 EffectType = 0;
+	uint8 Element = 0;
+	uint8 StatusEffect = 0;
+	uint8 StatusDuration = 0;
+	bool bTargetsAll = false;
+	bool bTargetsAllies = false;
+};
+
+/**
+ * Linhas alteradas por FEnemyDatabase::ApplyUpdate (índices no banco atualizado)
+ */
+struct FEnemyDatabaseDiff
+{
+	/** Registros com stats, nomes ou lista de skills diferentes, ou que usam uma skill alterada */
+	TArray<int32> ChangedRecords;
+	TArray<int32> AddedRecords;
+
+	TArray<int32> ChangedSkills;
+	TArray<int32> AddedSkills;
+
+	/** Linhas que sumiram do arquivo (continuam no banco até a próxima carga completa) */
+	int32 NumRemovedRecords = 0;
+
+	/** O banco foi trocado inteiro: todos os índices podem ter mudado */
+	bool bFullReload = false;
+
+	void Reset()
+	{
+		ChangedRecords.Reset();
+		AddedRecords.Reset();
+		ChangedSkills.Reset();
+		AddedSkills.Reset();
+		NumRemovedRecords = 0;
+		bFullReload = false;
+	}
+
+	bool IsEmpty() const
+	{
+		return !bFullReload && ChangedRecords.Num() == 0 && AddedRecords.Num() == 0
+			&& ChangedSkills.Num() == 0 && AddedSkills.Num() == 0 && NumRemovedRecords == 0;
+	}
+};
+
+/**
+ * Banco de inimigos "assado"
+ * Gerado pelo BakeEnemyDatabaseCommandlet a partir dos CDOs de todas as
+ * subclasses de AEnemyBase. Em runtime (simulação, IA, prévias de batalha)
+ * é lido de um único arquivo binário, sem carregar nenhuma UClass.
+ * Registros e skills são arrays POD; nomes ficam em arrays paralelos.
+ */
+class J_API FEnemyDatabase
+{
+public:
+	/** Arquivo padrão: Content/Data/EnemyDatabase.bin (empacotado com o jogo) */
+	static FString GetDefaultPath();
+
+	void Reset();
+
+	/** Adiciona (ou atualiza) o arquétipo de um CDO; retorna o índice */
+	int32 AddArchetype(const AEnemyBase& EnemyDefaults);
+
+	/** Adiciona um registro sem classe nem skills (dados sintéticos de benchmark) */
+	int32 AddRecord(FName DemonID, const FEnemyRecord& Record);
+
+	// ==================== CONSULTA ====================
+
+	int32 Num() const { return Records.Num(); }
+
+	/** Índice pelo DemonID, ou INDEX_NONE */
+	int32 FindByDemonID(FName DemonID) const;
+
+	/** Índice pelo caminho da classe (ex.: /Game/Enemies/BP_Pixie.BP_Pixie_C), ou INDEX_NONE */
+	int32 FindByClassPath(FName ClassPath) const;
+
+	const FEnemyRecord& GetRecord(int32 Index) const { return Records[Index]; }
+	FName GetDemonID(int32 Index) const { return DemonIDs[Index]; }
+	FName GetClassPath(int32 Index) const { return ClassPaths[Index]; }
+	FName GetDropItem(int32 Index) const { return DropItems[Index]; }
+
+	/** Afinidade desempacotada */
+	EElementAffinity GetAffinity(int32 Index, ERPGElement Element) const
+	{
+		return UnpackAffinity(Records[Index].PackedAffinities, Element);
+	}
+
+	static FORCEINLINE EElementAffinity UnpackAffinity(uint32 PackedAffinities, ERPGElement Element)
+	{
+		return (EElementAffinity)((PackedAffinities >> ((uint32)Element * 3)) & 0x7);
+	}
+
+	/** Todas as afinidades de volta para o formato do UCombatantComponent */
+	static FElementAffinities UnpackAffinities(uint32 PackedAffinities);
+
+	/** Skills do arquétipo (índices em GetSkill) */
+	TConstArrayView<uint16> GetSkillIndices(int32 Index) const
+	{
+		return GetSkillIndices(Records[Index].FirstSkill, Records[Index].NumSkills);
+	}
+
+	/** Faixa FirstSkill/NumSkills de um registro (já copiada para outro lugar) */
+	TConstArrayView<uint16> GetSkillIndices(uint16 FirstSkill, uint16 Count) const
+	{
+		return TConstArrayView<uint16>(SkillIndices.GetData() + FirstSkill, Count);
+	}
+
+	const FEnemySkillRecord& GetSkill(int32 SkillIndex) const { return Skills[SkillIndex]; }
+	FName GetSkillID(int32 SkillIndex) const { return SkillIDs[SkillIndex]; }
+	int32 NumSkills() const { return Skills.Num(); }
+
+	/** Reconstrói o FSkillData de uma skill (sem textos) */
+	FSkillData MakeSkillData(int32 SkillIndex) const;
+
+	/** Copia os números da skill para InOutSkill, mantendo ID e textos */
+	void ApplySkillRecord(int32 SkillIndex, FSkillData& InOutSkill) const;
+
+	// ==================== ARQUIVO ====================
+
+	void SaveToBytes(TArray<uint8>& OutBytes) const;
+	bool LoadFromBytes(const TArray<uint8>& Bytes);
+
+	bool SaveToFile(const FString& Path) const;
+	bool LoadFromFile(const FString& Path);
+
+	// ==================== RECARGA ====================
+
+	/**
+	 * Aplica um banco recém-lido só nas linhas que mudaram
+	 * Registros são casados pelo caminho da classe (ou DemonID, nos sintéticos)
+	 * e skills pelo SkillID. Índices existentes continuam válidos: linhas novas
+	 * vão para o fim, linhas removidas do arquivo ficam e uma lista de skills
+	 * alterada ganha uma faixa nova em SkillIndices (a antiga fica órfã até a
+	 * próxima carga completa). Retorna false, sem alterar nada, se o banco
+	 * precisar ser trocado inteiro (faixas de skill esgotadas).
+	 */
+	bool ApplyUpdate(const FEnemyDatabase& Source, FEnemyDatabaseDiff& OutDiff);
+
+private:
+	/** Skill deduplicada pelo SkillID */
+	uint16 AddSkill(const FSkillData& Skill);
+
+	/** Reaproveita a faixa de skills de Record se for igual a Indices, senão cria outra no fim */
+	void AssignSkillRange(FEnemyRecord& Record, TConstArrayView<uint16> Indices);
+
+	/** Recria os índices de busca depois de carregar */
+	void RebuildIndex();
+
+	TArray<FEnemyRecord> Records;
+	TArray<FName> DemonIDs;
+	TArray<FName> ClassPaths;
+	TArray<FName> DropItems;
+
+	TArray<uint16> SkillIndices;
+	TArray<FEnemySkillRecord> Skills;
+	TArray<FName> SkillIDs;
+
+	TMap<FName, int32> IndexByDemonID;
+	TMap<FName, int32> IndexByClassPath;
+	TMap<FName, uint16> SkillIndexByID;
+};
@@ -0,0 +1,168 @@
+// EnemyDatabaseSubsystem.cpp
+
+#include "EnemyDatabaseSubsystem.h"
+#include "EnemyBase.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	TAutoConsoleVariable<bool> CVarEnemyDatabaseHotReload(
+		TEXT("j.EnemyDatabase.HotReload"),
+		true,
+		TEXT("Recarrega o EnemyDatabase.bin quando o arquivo muda (só as linhas alteradas)"));
+
+	/** Intervalo entre verificações da data do arquivo */
+	constexpr float DatabasePollInterval = 0.5f;
+}
+#endif
+
+void UEnemyDatabaseSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const FString Path = FEnemyDatabase::GetDefaultPath();
+	const double Start = FPlatformTime::Seconds();
+	LoadedTimestamp = IFileManager::Get().GetTimeStamp(*Path);
+	if (Database.LoadFromFile(Path))
+	{
+		UE_LOG(LogTemp, Log, TEXT("EnemyDatabase: %d inimigos, %d skills carregados em %.2f ms"),
+			Database.Num(), Database.NumSkills(), (FPlatformTime::Seconds() - Start) * 1000.0);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EnemyDatabase: %s não encontrado; rode -run=BakeEnemyDatabase"), *Path);
+	}
+
+#if !UE_BUILD_SHIPPING
+	PollHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UEnemyDatabaseSubsystem::PollDatabaseFile), DatabasePollInterval);
+#endif
+}
+
+void UEnemyDatabaseSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(PollHandle);
+	PollHandle.Reset();
+	OnDatabaseUpdated.Clear();
+
+	Super::Deinitialize();
+}
+
+bool UEnemyDatabaseSubsystem::PollDatabaseFile(float DeltaTime)
+{
+#if !UE_BUILD_SHIPPING
+	if (CVarEnemyDatabaseHotReload.GetValueOnGameThread())
+	{
+		// Uma consulta de metadados a cada meio segundo; o arquivo só é lido se a data mudou
+		const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*FEnemyDatabase::GetDefaultPath());
+		if (Timestamp != FDateTime::MinValue() && Timestamp != LoadedTimestamp)
+		{
+			ReloadDatabase();
+		}
+	}
+#endif
+	return true;
+}
+
+bool UEnemyDatabaseSubsystem::ReloadDatabase()
+{
+	const FString Path = FEnemyDatabase::GetDefaultPath();
+	const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*Path);
+
+	// Arquivo ausente ou pela metade (ainda sendo gravado): manter o banco atual e tentar de novo
+	const double Start = FPlatformTime::Seconds();
+	if (!Incoming.LoadFromFile(Path))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EnemyDatabase: Recarga falhou, mantendo o banco atual"));
+		return false;
+	}
+	LoadedTimestamp = Timestamp;
+	const double ReadMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	if (Database.ApplyUpdate(Incoming, LastDiff))
+	{
+		ReloadedRecords.SetNum(Database.Num(), false);
+		for (int32 Index : LastDiff.ChangedRecords)
+		{
+			ReloadedRecords[Index] = true;
+		}
+		for (int32 Index : LastDiff.AddedRecords)
+		{
+			ReloadedRecords[Index] = true;
+		}
+	}
+	else
+	{
+		// Sem como preservar os índices: trocar tudo e avisar que todos mudaram
+		Database = MoveTemp(Incoming);
+		LastDiff.Reset();
+		LastDiff.bFullReload = true;
+		ReloadedRecords.Init(true, Database.Num());
+	}
+
+	const double TotalMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	if (LastDiff.IsEmpty())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("EnemyDatabase: Arquivo regravado sem mudanças (%.3f ms)"), TotalMs);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("EnemyDatabase: Recarregado em %.3f ms (leitura %.3f ms)%s: %d registros alterados, %d novos, %d removidos; %d skills alteradas, %d novas"),
+		TotalMs, ReadMs, LastDiff.bFullReload ? TEXT(" [completo]") : TEXT(""),
+		LastDiff.ChangedRecords.Num(), LastDiff.AddedRecords.Num(), LastDiff.NumRemovedRecords,
+		LastDiff.ChangedSkills.Num(), LastDiff.AddedSkills.Num());
+
+	OnDatabaseUpdated.Broadcast(Database, LastDiff);
+	return true;
+}
+
+FEncounterPreview UEnemyDatabaseSubsystem::PreviewEncounter(const FEncounterData& Encounter, const FEncounterSpawnDescriptor& Spawn) const
+{
+	FEncounterPreview Preview;
+	Preview.NumEnemies = Spawn.Num();
+
+	// Um registro por tipo sorteado, não por spawn
+	uint32 WeakMask = 0;
+	for (int32 Type = 0; Type < Spawn.EnemyCounts.Num(); Type++)
+	{
+		const int32 Count = Spawn.EnemyCounts[Type];
+		if (Count == 0)
+		{
+			continue;
+		}
+
+		const UClass* EnemyClass = Encounter.GetEnemyClass(Type);
+		const int32 Index = EnemyClass ? Database.FindByClassPath(FName(*EnemyClass->GetPathName())) : INDEX_NONE;
+		if (Index == INDEX_NONE)
+		{
+			Preview.NumUnknown += Count;
+			continue;
+		}
+
+		const FEnemyRecord& Record = Database.GetRecord(Index);
+		Preview.TotalHP += Record.MaxHP * Count;
+		Preview.MaxLevel = FMath::Max(Preview.MaxLevel, Record.Level);
+		Preview.Experience += Record.ExperienceReward * Count;
+		Preview.Gold += Record.GoldReward * Count;
+
+		for (uint8 Element = (uint8)ERPGElement::Physical; Element <= (uint8)ERPGElement::Dark; Element++)
+		{
+			if (Database.GetAffinity(Index, (ERPGElement)Element) == EElementAffinity::Weak)
+			{
+				WeakMask |= 1u << Element;
+			}
+		}
+	}
+
+	for (uint8 Element = (uint8)ERPGElement::Physical; Element <= (uint8)ERPGElement::Dark; Element++)
+	{
+		if (WeakMask & (1u << Element))
+		{
+			Preview.WeakElements.Add((ERPGElement)Element);
+		}
+	}
+
+	return Preview;
+}
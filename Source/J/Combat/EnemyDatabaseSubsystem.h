@@ -0,0 +1,105 @@
+// EnemyDatabaseSubsystem.h
+// Acesso em runtime ao banco de inimigos assado
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Core/RPGTypes.h"
+#include "EnemyDatabase.h"
+#include "Containers/Ticker.h"
+#include "EnemyDatabaseSubsystem.generated.h"
+
+/** Banco já atualizado + linhas que mudaram */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEnemyDatabaseUpdated, const FEnemyDatabase& /*Database*/, const FEnemyDatabaseDiff& /*Diff*/);
+
+/**
+ * Prévia de uma batalha calculada só com o banco assado (nada é spawnado)
+ */
+USTRUCT(BlueprintType)
+struct FEncounterPreview
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	int32 NumEnemies = 0;
+
+	/** Inimigos cuja classe não está no banco (rode o BakeEnemyDatabase) */
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	int32 NumUnknown = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	int32 TotalHP = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	int32 MaxLevel = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	int32 Experience = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	int32 Gold = 0;
+
+	/** Elementos a que pelo menos um inimigo é fraco */
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	TArray<ERPGElement> WeakElements;
+};
+
+/**
+ * Carrega Content/Data/EnemyDatabase.bin no início da sessão
+ * Stats, afinidades, skills e recompensas de todos os arquétipos ficam
+ * disponíveis sem carregar Blueprints de inimigo.
+ *
+ * Fora do Shipping, o arquivo é vigiado (j.EnemyDatabase.HotReload): quando o
+ * BakeEnemyDatabase ou o EncounterTuner o regravam, só as linhas alteradas são
+ * aplicadas (FEnemyDatabase::ApplyUpdate) e OnDatabaseUpdated avisa quem
+ * guarda cópias delas (AEnemyBase vivos). Quem lê o banco por referência
+ * (prévias, FBattleSimulator::Run no game thread) já vê os valores novos.
+ */
+UCLASS()
+class J_API UEnemyDatabaseSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	const FEnemyDatabase& GetDatabase() const { return Database; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemies")
+	bool IsLoaded() const { return Database.Num() > 0; }
+
+	/** Soma HP, nível, recompensas e fraquezas de uma composição já sorteada */
+	UFUNCTION(BlueprintCallable, Category = "Enemies")
+	FEncounterPreview PreviewEncounter(const FEncounterData& Encounter, const FEncounterSpawnDescriptor& Spawn) const;
+
+	// ==================== RECARGA ====================
+
+	/** Relê o arquivo e aplica só as linhas alteradas; false se não deu para ler (o banco atual fica) */
+	UFUNCTION(BlueprintCallable, Category = "Enemies")
+	bool ReloadDatabase();
+
+	/** A linha foi recarregada nesta sessão? (então vale mais que o CDO do inimigo) */
+	bool WasRecordReloaded(int32 Index) const { return ReloadedRecords.IsValidIndex(Index) && ReloadedRecords[Index]; }
+
+	/** Disparado após cada recarga que mudou alguma linha */
+	FOnEnemyDatabaseUpdated OnDatabaseUpdated;
+
+private:
+	/** Confere a data do arquivo (ticker, fora do Shipping) */
+	bool PollDatabaseFile(float DeltaTime);
+
+	FEnemyDatabase Database;
+
+	/** Destino da leitura na recarga (reaproveitado) */
+	FEnemyDatabase Incoming;
+
+	FEnemyDatabaseDiff LastDiff;
+
+	/** Um bit por registro alterado desde o início da sessão */
+	TBitArray<> ReloadedRecords;
+
+	FDateTime LoadedTimestamp;
+	FTSTicker::FDelegateHandle PollHandle;
+};
@@ -0,0 +1,86 @@
+// ProgressionSystem.cpp
+
+#include "ProgressionSystem.h"
+
+namespace
+{
+	/** Tabelas indexadas por nível (índice 0 não é usado) */
+	struct FLevelTables
+	{
+		int32 TotalExp[FProgression::MaxLevel + 1] = {};
+
+		/** HP/MP máximos ganhos acumulados do nível 1 até o nível */
+		int32 TotalHPGain[FProgression::MaxLevel + 1] = {};
+		int32 TotalMPGain[FProgression::MaxLevel + 1] = {};
+	};
+
+	constexpr FLevelTables BuildLevelTables()
+	{
+		FLevelTables Tables;
+		for (int32 Level = 2; Level <= FProgression::MaxLevel; Level++)
+		{
+			// Curva cúbica suave: 21 EXP para o nível 2, ~777k para o 99
+			Tables.TotalExp[Level] = (4 * Level * Level * Level) / 5 + 15 * (Level - 1);
+
+			// HP/MP ganhos ao atingir o nível crescem devagar
+			Tables.TotalHPGain[Level] = Tables.TotalHPGain[Level - 1] + 6 + Level / 8;
+			Tables.TotalMPGain[Level] = Tables.TotalMPGain[Level - 1] + 3 + Level / 16;
+		}
+		return Tables;
+	}
+
+	constexpr FLevelTables LevelTables = BuildLevelTables();
+
+	static_assert(LevelTables.TotalExp[1] == 0, "Nível 1 começa com 0 EXP");
+	static_assert(LevelTables.TotalExp[2] == 21, "Curva de EXP alterada");
+
+	/** Pontos ganhos de FromLevel até ToLevel com taxa em décimos por nível */
+	FORCEINLINE int32 GrowthBetween(int32 Rate, int32 FromLevel, int32 ToLevel)
+	{
+		return (ToLevel * Rate) / 10 - (FromLevel * Rate) / 10;
+	}
+}
+
+int32 FProgression::GetTotalExpForLevel(int32 Level)
+{
+	return LevelTables.TotalExp[FMath::Clamp(Level, 1, MaxLevel)];
+}
+
+int32 FProgression::GetExpToNextLevel(int32 Level, int32 Experience)
+{
+	return Level >= MaxLevel ? 0 : FMath::Max(0, GetTotalExpForLevel(Level + 1) - Experience);
+}
+
+int32 FProgression::GetLevelForExp(int32 Experience, int32 FromLevel)
+{
+	int32 Level = FMath::Clamp(FromLevel, 1, MaxLevel);
+	while (Level < MaxLevel && Experience >= LevelTables.TotalExp[Level + 1])
+	{
+		Level++;
+	}
+	return Level;
+}
+
+void FProgression::ApplyLevelGrowth(FCharacterStats& Stats, const FStatGrowth& Growth, int32 FromLevel, int32 ToLevel)
+{
+	FromLevel = FMath::Clamp(FromLevel, 1, MaxLevel);
+	ToLevel = FMath::Clamp(ToLevel, 1, MaxLevel);
+	if (ToLevel <= FromLevel)
+	{
+		return;
+	}
+
+	const int32 HPGain = LevelTables.TotalHPGain[ToLevel] - LevelTables.TotalHPGain[FromLevel];
+	const int32 MPGain = LevelTables.TotalMPGain[ToLevel] - LevelTables.TotalMPGain[FromLevel];
+
+	Stats.Level = ToLevel;
+	Stats.MaxHP += HPGain;
+	Stats.CurrentHP += HPGain;
+	Stats.MaxMP += MPGain;
+	Stats.CurrentMP += MPGain;
+	Stats.Strength += GrowthBetween(Growth.Strength, FromLevel, ToLevel);
+	Stats.Magic += GrowthBetween(Growth.Magic, FromLevel, ToLevel);
+	Stats.Vitality += GrowthBetween(Growth.Vitality, FromLevel, ToLevel);
+	Stats.Agility += GrowthBetween(Growth.Agility, FromLevel, ToLevel);
+	Stats.Luck += GrowthBetween(Growth.Luck, FromLevel, ToLevel);
+}
@@ -0,0 +1,29 @@
+// ProgressionSystem.h
+// Curva de EXP e crescimento de stats por nível
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+
+/**
+ * Progressão de nível
+ * A curva de EXP e os ganhos de HP/MP por nível são tabelas constexpr geradas
+ * em tempo de compilação; subir vários níveis de uma vez custa O(níveis ganhos).
+ */
+struct J_API FProgression
+{
+	static constexpr int32 MaxLevel = 99;
+
+	/** EXP acumulado necessário para atingir o nível */
+	static int32 GetTotalExpForLevel(int32 Level);
+
+	/** EXP que falta para o próximo nível (0 no nível máximo) */
+	static int32 GetExpToNextLevel(int32 Level, int32 Experience);
+
+	/** Nível correspondente a Experience, procurando a partir de FromLevel */
+	static int32 GetLevelForExp(int32 Experience, int32 FromLevel = 1);
+
+	/** Aplica o crescimento de stats de FromLevel até ToLevel (HP/MP ganhos também são recuperados) */
+	static void ApplyLevelGrowth(FCharacterStats& Stats, const FStatGrowth& Growth, int32 FromLevel, int32 ToLevel);
+};
@@ -0,0 +1,181 @@
+// StatusEffectSystem.cpp
+
+#include "StatusEffectSystem.h"
+
+const FStatusModifiers FStatusEffectSystem::NeutralModifiers;
+
+void FStatusEffectSystem::Initialize(int32 NumParticipants)
+{
+	Effects.SetNumUninitialized(NumParticipants * MaxEffectsPerParticipant, EAllowShrinking::No);
+	EffectCounts.SetNumZeroed(NumParticipants, EAllowShrinking::No);
+	Modifiers.SetNum(NumParticipants, EAllowShrinking::No);
+	Reset();
+}
+
+void FStatusEffectSystem::Reset()
+{
+	FMemory::Memzero(EffectCounts.GetData(), EffectCounts.Num() * sizeof(uint8));
+	for (FStatusModifiers& Modifier : Modifiers)
+	{
+		Modifier = FStatusModifiers();
+	}
+}
+
+bool FStatusEffectSystem::ApplyEffect(int32 Participant, EStatusEffect Effect, int32 CurrentTurn, int32 Duration)
+{
+	if (!EffectCounts.IsValidIndex(Participant) || Effect == EStatusEffect::None || Effect == EStatusEffect::MAX)
+	{
+		return false;
+	}
+
+	const int32 ExpireTurn = CurrentTurn + FMath::Max(1, Duration);
+
+	// Já ativo: apenas renovar a duração
+	const int32 ExistingSlot = FindEffectSlot(Participant, Effect);
+	if (ExistingSlot != INDEX_NONE)
+	{
+		Effects[ExistingSlot].ExpireTurn = FMath::Max(Effects[ExistingSlot].ExpireTurn, ExpireTurn);
+		return true;
+	}
+
+	// Buff e debuff opostos se anulam (Tarukaja x Tarunda, etc.)
+	EStatusEffect Opposite = EStatusEffect::None;
+	switch (Effect)
+	{
+	case EStatusEffect::Tarukaja: Opposite = EStatusEffect::Tarunda; break;
+	case EStatusEffect::Rakukaja: Opposite = EStatusEffect::Rakunda; break;
+	case EStatusEffect::Sukukaja: Opposite = EStatusEffect::Sukunda; break;
+	case EStatusEffect::Tarunda:  Opposite = EStatusEffect::Tarukaja; break;
+	case EStatusEffect::Rakunda:  Opposite = EStatusEffect::Rakukaja; break;
+	case EStatusEffect::Sukunda:  Opposite = EStatusEffect::Sukukaja; break;
+	default: break;
+	}
+
+	if (Opposite != EStatusEffect::None && RemoveEffect(Participant, Opposite))
+	{
+		return true;
+	}
+
+	const int32 Slot = Participant * MaxEffectsPerParticipant + EffectCounts[Participant];
+	Effects[Slot].Effect = Effect;
+	Effects[Slot].ExpireTurn = ExpireTurn;
+	EffectCounts[Participant]++;
+
+	RecomputeModifiers(Participant);
+	return true;
+}
+
+bool FStatusEffectSystem::RemoveEffect(int32 Participant, EStatusEffect Effect)
+{
+	const int32 Slot = FindEffectSlot(Participant, Effect);
+	if (Slot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Remoção por swap com o último slot ocupado do bloco
+	const int32 LastSlot = Participant * MaxEffectsPerParticipant + EffectCounts[Participant] - 1;
+	Effects[Slot] = Effects[LastSlot];
+	EffectCounts[Participant]--;
+
+	RecomputeModifiers(Participant);
+	return true;
+}
+
+bool FStatusEffectSystem::HasEffect(int32 Participant, EStatusEffect Effect) const
+{
+	return FindEffectSlot(Participant, Effect) != INDEX_NONE;
+}
+
+void FStatusEffectSystem::TickTurn(int32 CurrentTurn, FBattleIndexArray& OutPoisonedParticipants)
+{
+	OutPoisonedParticipants.Reset();
+
+	for (int32 Participant = 0; Participant < EffectCounts.Num(); Participant++)
+	{
+		const int32 BlockStart = Participant * MaxEffectsPerParticipant;
+		int32 Count = EffectCounts[Participant];
+		bool bChanged = false;
+
+		for (int32 i = 0; i < Count; )
+		{
+			if (Effects[BlockStart + i].ExpireTurn <= CurrentTurn)
+			{
+				Effects[BlockStart + i] = Effects[BlockStart + Count - 1];
+				Count--;
+				bChanged = true;
+			}
+			else
+			{
+				i++;
+			}
+		}
+
+		if (bChanged)
+		{
+			EffectCounts[Participant] = (uint8)Count;
+			RecomputeModifiers(Participant);
+		}
+
+		if (Modifiers[Participant].bPoisoned)
+		{
+			OutPoisonedParticipants.Add(Participant);
+		}
+	}
+}
+
+TConstArrayView<FActiveStatusEffect> FStatusEffectSystem::GetEffects(int32 Participant) const
+{
+	if (!EffectCounts.IsValidIndex(Participant))
+	{
+		return TConstArrayView<FActiveStatusEffect>();
+	}
+
+	return TConstArrayView<FActiveStatusEffect>(Effects.GetData() + Participant * MaxEffectsPerParticipant, EffectCounts[Participant]);
+}
+
+void FStatusEffectSystem::RecomputeModifiers(int32 Participant)
+{
+	FStatusModifiers& Result = Modifiers[Participant];
+	Result = FStatusModifiers();
+
+	for (const FActiveStatusEffect& Active : GetEffects(Participant))
+	{
+		switch (Active.Effect)
+		{
+		case EStatusEffect::Tarukaja:  Result.AttackPermille = FCombatMath::MulPermille(Result.AttackPermille, 1400); break;
+		case EStatusEffect::Tarunda:   Result.AttackPermille = FCombatMath::MulPermille(Result.AttackPermille, 700); break;
+		case EStatusEffect::Rakukaja:  Result.DamageTakenPermille = FCombatMath::MulPermille(Result.DamageTakenPermille, 700); break;
+		case EStatusEffect::Rakunda:   Result.DamageTakenPermille = FCombatMath::MulPermille(Result.DamageTakenPermille, 1400); break;
+		case EStatusEffect::Sukukaja:  Result.HitEvasionBonus += 200; break;
+		case EStatusEffect::Sukunda:   Result.HitEvasionBonus -= 200; break;
+		case EStatusEffect::Guard:     Result.DamageTakenPermille = FCombatMath::MulPermille(Result.DamageTakenPermille, 500); break;
+		case EStatusEffect::Poison:    Result.bPoisoned = true; break;
+		case EStatusEffect::Paralysis: Result.bCanAct = false; break;
+		case EStatusEffect::Sleep:
+			Result.bCanAct = false;
+			Result.DamageTakenPermille = FCombatMath::MulPermille(Result.DamageTakenPermille, 1500);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+int32 FStatusEffectSystem::FindEffectSlot(int32 Participant, EStatusEffect Effect) const
+{
+	if (!EffectCounts.IsValidIndex(Participant))
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 BlockStart = Participant * MaxEffectsPerParticipant;
+	for (int32 i = 0; i < EffectCounts[Participant]; i++)
+	{
+		if (Effects[BlockStart + i].Effect == Effect)
+		{
+			return BlockStart + i;
+		}
+	}
+	return INDEX_NONE;
+}
@@ -0,0 +1,110 @@
+// StatusEffectSystem.h
+// Buffs/debuffs/ailments por participante, com expiração por turno
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+#include "CombatMath.h"
+#include "BattleArena.h"
+
+/**
+ * Efeito ativo em um participante
+ */
+struct FActiveStatusEffect
+{
+	EStatusEffect Effect = EStatusEffect::None;
+
+	/** Turno em que o efeito expira (removido no tick desse turno) */
+	int32 ExpireTurn = 0;
+};
+
+/**
+ * Multiplicadores agregados de um participante
+ * Recalculados apenas quando a lista de efeitos muda; as fórmulas de dano
+ * leem só esta estrutura, nunca a lista de efeitos.
+ */
+struct FStatusModifiers
+{
+	/** Multiplica o dano causado (permilagem, ver FCombatMath) */
+	int32 AttackPermille = FCombatMath::One;
+
+	/** Multiplica o dano recebido (permilagem) */
+	int32 DamageTakenPermille = FCombatMath::One;
+
+	/** Permilagem somada ao acerto (atacante) e à evasão (defensor) */
+	int32 HitEvasionBonus = 0;
+
+	/** Pode agir neste turno? */
+	bool bCanAct = true;
+
+	/** Perde HP no início de cada turno? */
+	bool bPoisoned = false;
+};
+
+/**
+ * Motor de efeitos de status do combate
+ * Os efeitos ficam em um único array plano com um bloco fixo por participante
+ * (um slot por tipo de efeito), então aplicar/expirar nunca aloca depois do
+ * Initialize, e o tick de turno percorre todos os participantes em uma passada.
+ */
+class J_API FStatusEffectSystem
+{
+public:
+	/** Um participante nunca tem mais de um efeito do mesmo tipo */
+	static constexpr int32 MaxEffectsPerParticipant = (int32)EStatusEffect::MAX - 1;
+
+	/** Prepara o sistema para NumParticipants (reaproveita a memória entre combates) */
+	void Initialize(int32 NumParticipants);
+
+	/** Remove todos os efeitos mantendo a memória alocada */
+	void Reset();
+
+	/** Aplica (ou renova) um efeito até CurrentTurn + Duration */
+	bool ApplyEffect(int32 Participant, EStatusEffect Effect, int32 CurrentTurn, int32 Duration);
+
+	/** Remove um efeito específico */
+	bool RemoveEffect(int32 Participant, EStatusEffect Effect);
+
+	/** O participante tem este efeito? */
+	bool HasEffect(int32 Participant, EStatusEffect Effect) const;
+
+	/**
+	 * Avança para CurrentTurn: remove efeitos expirados de todos os participantes
+	 * e grava em OutPoisonedParticipants quem deve sofrer dano de veneno.
+	 */
+	void TickTurn(int32 CurrentTurn, FBattleIndexArray& OutPoisonedParticipants);
+
+	/** Multiplicadores agregados (neutros para índices inválidos) */
+	const FStatusModifiers& GetModifiers(int32 Participant) const
+	{
+		return Modifiers.IsValidIndex(Participant) ? Modifiers[Participant] : NeutralModifiers;
+	}
+
+	/** Número de efeitos ativos em um participante */
+	int32 GetNumEffects(int32 Participant) const
+	{
+		return EffectCounts.IsValidIndex(Participant) ? EffectCounts[Participant] : 0;
+	}
+
+	/** Efeitos ativos de um participante */
+	TConstArrayView<FActiveStatusEffect> GetEffects(int32 Participant) const;
+
+private:
+	/** Recalcula os multiplicadores agregados de um participante */
+	void RecomputeModifiers(int32 Participant);
+
+	/** Índice do efeito no bloco do participante, ou INDEX_NONE */
+	int32 FindEffectSlot(int32 Participant, EStatusEffect Effect) const;
+
+	/** NumParticipants * MaxEffectsPerParticipant slots */
+	TArray<FActiveStatusEffect> Effects;
+
+	/** Slots ocupados no início do bloco de cada participante */
+	TArray<uint8> EffectCounts;
+
+	/** Multiplicadores agregados por participante */
+	TArray<FStatusModifiers> Modifiers;
+
+	static const FStatusModifiers NeutralModifiers;
+};
@@ -0,0 +1,72 @@
+// BakeEnemyDatabaseCommandlet.cpp
+
+#include "BakeEnemyDatabaseCommandlet.h"
+#include "Combat/EnemyBase.h"
+#include "Combat/EnemyDatabase.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+UBakeEnemyDatabaseCommandlet::UBakeEnemyDatabaseCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBakeEnemyDatabaseCommandlet::Main(const FString& Params)
+{
+	FString OutputPath = FEnemyDatabase::GetDefaultPath();
+	FParse::Value(*Params, TEXT("output="), OutputPath);
+
+	// Subclasses nativas e Blueprint (pelas tags do asset registry, sem carregar nada ainda)
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.SearchAllAssets(true);
+
+	TSet<FTopLevelAssetPath> DerivedClasses;
+	AssetRegistry.GetDerivedClassNames({ AEnemyBase::StaticClass()->GetClassPathName() }, {}, DerivedClasses);
+
+	const double Start = FPlatformTime::Seconds();
+	FEnemyDatabase Database;
+	int32 NumSkipped = 0;
+
+	for (const FTopLevelAssetPath& ClassPath : DerivedClasses)
+	{
+		const UClass* EnemyClass = LoadObject<UClass>(nullptr, *ClassPath.ToString());
+		if (!EnemyClass || EnemyClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated) || !EnemyClass->IsChildOf<AEnemyBase>())
+		{
+			NumSkipped++;
+			continue;
+		}
+
+		// Pular classes REINST/SKEL geradas pelo compilador de Blueprints
+		if (EnemyClass->GetName().StartsWith(TEXT("SKEL_")) || EnemyClass->GetName().StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const AEnemyBase* Defaults = EnemyClass->GetDefaultObject<AEnemyBase>();
+		const int32 Index = Database.AddArchetype(*Defaults);
+		UE_LOG(LogTemp, Display, TEXT("BakeEnemyDatabase: [%d] %s (%s)"), Index, *Defaults->DemonID.ToString(), *ClassPath.ToString());
+	}
+
+	const double BakeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	if (!Database.SaveToFile(OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("BakeEnemyDatabase: Falha ao gravar %s"), *OutputPath);
+		return 1;
+	}
+
+	// Quanto custa o caminho de runtime
+	FEnemyDatabase Loaded;
+	const double LoadStart = FPlatformTime::Seconds();
+	const bool bLoaded = Loaded.LoadFromFile(OutputPath);
+	const double LoadMs = (FPlatformTime::Seconds() - LoadStart) * 1000.0;
+
+	UE_LOG(LogTemp, Display, TEXT("BakeEnemyDatabase: %d inimigos, %d skills (%d classes ignoradas) em %.1f ms -> %s"),
+		Database.Num(), Database.NumSkills(), NumSkipped, BakeMs, *OutputPath);
+	UE_LOG(LogTemp, Display, TEXT("BakeEnemyDatabase: Leitura do arquivo: %.3f ms (%s)"),
+		LoadMs, bLoaded && Loaded.Num() == Database.Num() ? TEXT("ok") : TEXT("FALHOU"));
+
+	return bLoaded ? 0 : 1;
+}
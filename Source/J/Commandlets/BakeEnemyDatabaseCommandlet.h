@@ -0,0 +1,26 @@
+// BakeEnemyDatabaseCommandlet.h
+// Gera o banco plano de inimigos a partir dos Blueprints
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BakeEnemyDatabaseCommandlet.generated.h"
+
+/**
+ * Assa todos os arquétipos de inimigo em Content/Data/EnemyDatabase.bin
+ * Uso: UnrealEditor-Cmd J.uproject -run=BakeEnemyDatabase [-output=Caminho/EnemyDatabase.bin]
+ * Carrega cada subclasse concreta de AEnemyBase (nativa ou Blueprint), lê o CDO
+ * e grava stats, afinidades empacotadas, skills deduplicadas e recompensas.
+ * Rode antes do cook sempre que um inimigo mudar.
+ */
+UCLASS()
+class J_API UBakeEnemyDatabaseCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBakeEnemyDatabaseCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
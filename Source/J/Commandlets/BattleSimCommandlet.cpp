@@ -0,0 +1,151 @@
+// BattleSimCommandlet.cpp
+
+#include "BattleSimCommandlet.h"
+#include "Combat/BattleSimulator.h"
+#include "Combat/EnemyDatabase.h"
+
+namespace
+{
+	/** Lista de DemonIDs separados por vírgula -> índices no banco */
+	bool ParseSide(const FEnemyDatabase& Database, const FString& List, TArray<int32>& OutIndices)
+	{
+		TArray<FString> Names;
+		List.ParseIntoArray(Names, TEXT(","));
+		for (const FString& Name : Names)
+		{
+			const int32 Index = Database.FindByDemonID(FName(*Name));
+			if (Index == INDEX_NONE)
+			{
+				UE_LOG(LogTemp, Error, TEXT("BattleSim: %s não está no banco de inimigos"), *Name);
+				return false;
+			}
+			OutIndices.Add(Index);
+		}
+		return OutIndices.Num() > 0;
+	}
+
+	/** Party e inimigos sintéticos para quando não há banco assado */
+	void AddSyntheticArchetypes(FEnemyDatabase& Database, FBattleSimConfig& Config)
+	{
+		FEnemyRecord Hero;
+		Hero.Level = 20;
+		Hero.MaxHP = 220;
+		Hero.MaxMP = 60;
+		Hero.Strength = 18;
+		Hero.Magic = 12;
+		Hero.Vitality = 15;
+		Hero.Agility = 14;
+		Hero.Luck = 10;
+
+		FEnemyRecord Demon;
+		Demon.Level = 18;
+		Demon.MaxHP = 160;
+		Demon.Strength = 16;
+		Demon.Magic = 10;
+		Demon.Vitality = 12;
+		Demon.Agility = 12;
+		Demon.Luck = 8;
+		Demon.PackedAffinities = (uint32)EElementAffinity::Weak << ((uint32)ERPGElement::Physical * 3);
+
+		const int32 HeroIndex = Database.AddRecord(TEXT("SimHero"), Hero);
+		const int32 DemonIndex = Database.AddRecord(TEXT("SimDemon"), Demon);
+		Config.Party = { HeroIndex, HeroIndex, HeroIndex, HeroIndex };
+		Config.Enemies = { DemonIndex, DemonIndex, DemonIndex };
+	}
+}
+
+UBattleSimCommandlet::UBattleSimCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UBattleSimCommandlet::Main(const FString& Params)
+{
+	int64 NumBattles = 1000000;
+	int32 NumThreads = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	int32 Seed = 1;
+	FString FormulaName = TEXT("Classic");
+	FString PartyList;
+	FString EnemyList;
+
+	FParse::Value(*Params, TEXT("battles="), NumBattles);
+	FParse::Value(*Params, TEXT("threads="), NumThreads);
+	FParse::Value(*Params, TEXT("seed="), Seed);
+	FParse::Value(*Params, TEXT("formula="), FormulaName);
+	FParse::Value(*Params, TEXT("party="), PartyList, false);
+	FParse::Value(*Params, TEXT("enemies="), EnemyList, false);
+	const bool bMeasureScaling = !FParse::Param(*Params, TEXT("noscaling"));
+	NumBattles = FMath::Max<int64>(1, NumBattles);
+	NumThreads = FMath::Max(1, NumThreads);
+
+	FBattleSimConfig Config;
+	const int64 FormulaValue = StaticEnum<EDamageFormula>()->GetValueByNameString(FormulaName);
+	Config.Formula = FormulaValue != INDEX_NONE ? (EDamageFormula)FormulaValue : EDamageFormula::Classic;
+
+	// Banco assado: carregar é o único custo de inicialização
+	const double LoadStart = FPlatformTime::Seconds();
+	FEnemyDatabase Database;
+	const bool bHasDatabase = Database.LoadFromFile(FEnemyDatabase::GetDefaultPath());
+	const double LoadMs = (FPlatformTime::Seconds() - LoadStart) * 1000.0;
+
+	if (bHasDatabase && !PartyList.IsEmpty() && !EnemyList.IsEmpty())
+	{
+		if (!ParseSide(Database, PartyList, Config.Party) || !ParseSide(Database, EnemyList, Config.Enemies))
+		{
+			return 1;
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Display, TEXT("BattleSim: Sem banco ou sem -party/-enemies, usando arquétipos sintéticos"));
+		AddSyntheticArchetypes(Database, Config);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("BattleSim: %lld batalhas, %d threads, seed %d, fórmula %s, %d vs %d (banco em %.2f ms)"),
+		NumBattles, NumThreads, Seed, *UEnum::GetValueAsString(Config.Formula), Config.Party.Num(), Config.Enemies.Num(), LoadMs);
+
+	double Start = FPlatformTime::Seconds();
+	const FBattleSimStats Stats = FBattleSimulator::Run(Database, Config, NumBattles, NumThreads, Seed);
+	const double Seconds = FPlatformTime::Seconds() - Start;
+
+	UE_LOG(LogTemp, Display, TEXT("BattleSim: Vitórias %.2f%%, derrotas %lld, empates %lld, %.2f rodadas/batalha, HP restante %.1f%%"),
+		Stats.GetWinRate() * 100.0, Stats.NumDefeats, Stats.NumTimeouts, Stats.GetAverageRounds(),
+		Stats.NumBattles > 0 ? Stats.TotalPartyHPPermille / 10.0 / Stats.NumBattles : 0.0);
+	UE_LOG(LogTemp, Display, TEXT("BattleSim: %.2f s, %.0f batalhas/s"), Seconds, Seconds > 0.0 ? NumBattles / Seconds : 0.0);
+
+	if (!bMeasureScaling)
+	{
+		return 0;
+	}
+
+	// Escala: 1, 2, 4... até NumThreads, sempre com as mesmas batalhas
+	bool bDeterministic = true;
+	double SingleThreadSeconds = 0.0;
+	for (int32 Threads = 1; ; Threads = FMath::Min(Threads * 2, NumThreads))
+	{
+		Start = FPlatformTime::Seconds();
+		const FBattleSimStats ScalingStats = FBattleSimulator::Run(Database, Config, NumBattles, Threads, Seed);
+		const double ScalingSeconds = FPlatformTime::Seconds() - Start;
+
+		if (Threads == 1)
+		{
+			SingleThreadSeconds = ScalingSeconds;
+		}
+
+		const double Speedup = ScalingSeconds > 0.0 ? SingleThreadSeconds / ScalingSeconds : 0.0;
+		bDeterministic &= ScalingStats == Stats;
+
+		UE_LOG(LogTemp, Display, TEXT("BattleSim: %3d threads: %.2f s, %.2fx, eficiência %.0f%%, totais iguais: %s"),
+			Threads, ScalingSeconds, Speedup, Speedup / Threads * 100.0, ScalingStats == Stats ? TEXT("sim") : TEXT("NÃO"));
+
+		if (Threads == NumThreads)
+		{
+			break;
+		}
+	}
+
+	return bDeterministic ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+// BattleSimCommandlet.h
+// Simulação em massa de batalhas para balanceamento
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BattleSimCommandlet.generated.h"
+
+/**
+ * Roda milhões de batalhas headless com o FBattleSimulator
+ * Uso: UnrealEditor-Cmd J.uproject -run=BattleSim [-battles=1000000] [-threads=T] [-seed=1]
+ *      [-formula=Classic|SMT1|SMT3|Persona] [-party=DemonA,DemonB] [-enemies=DemonC,DemonC] [-noscaling]
+ * Lê o Content/Data/EnemyDatabase.bin (sem ele, usa arquétipos sintéticos), reporta
+ * vitórias/derrotas e mede a escala de 1 até T threads, conferindo que os totais
+ * são idênticos em todas as contagens de threads.
+ */
+UCLASS()
+class J_API UBattleSimCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBattleSimCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
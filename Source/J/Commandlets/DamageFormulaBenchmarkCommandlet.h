@@ -0,0 +1,27 @@
+// DamageFormulaBenchmarkCommandlet.h
+// Benchmark das políticas de fórmula de dano
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DamageFormulaBenchmarkCommandlet.generated.h"
+
+/**
+ * Mede o custo por golpe de cada fórmula de dano em lote
+ * Uso: UnrealEditor-Cmd J.uproject -run=DamageFormulaBenchmark [-hits=1000000] [-seed=1] [-iterations=20]
+ * Compara a política Classic, escolhida em tempo de execução via FDamageFormulas::Dispatch,
+ * com o mesmo cálculo escrito à mão no laço: os tempos devem empatar e os resultados
+ * devem ser idênticos. Também mede FDamageFormulas::Distribution e confere a distribuição
+ * exata contra golpes amostrados com Resolve.
+ */
+UCLASS()
+class J_API UDamageFormulaBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDamageFormulaBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
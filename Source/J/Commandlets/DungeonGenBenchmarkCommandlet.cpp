@@ -0,0 +1,141 @@
+// DungeonGenBenchmarkCommandlet.cpp
+
+#include "DungeonGenBenchmarkCommandlet.h"
+#include "Dungeon/DungeonGenerator.h"
+#include "Encounters/RoamingEncounterSystem.h"
+#include "Misc/Crc.h"
+
+namespace
+{
+	uint32 HashLayout(const FDungeonFloorLayout& Layout)
+	{
+		const uint32 CellsHash = FCrc::MemCrc32(Layout.Grid.Cells.GetData(), Layout.Grid.Cells.Num());
+		return FCrc::MemCrc32(Layout.Grid.Regions.GetData(), Layout.Grid.Regions.Num(), CellsHash);
+	}
+}
+
+UDungeonGenBenchmarkCommandlet::UDungeonGenBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UDungeonGenBenchmarkCommandlet::Main(const FString& Params)
+{
+	FDungeonGenParams GenParams;
+	GenParams.Width = 256;
+	GenParams.Height = 256;
+	GenParams.MaxRooms = 96;
+	GenParams.NumEncounterTables = 4;
+	GenParams.CorridorEncounterTable = 0;
+
+	int32 NumFloors = 16;
+	int32 Seed = 1;
+	int32 Iterations = 20;
+	int32 NumGroups = 4000;
+	int32 NumSteps = 1000;
+
+	FParse::Value(*Params, TEXT("width="), GenParams.Width);
+	FParse::Value(*Params, TEXT("height="), GenParams.Height);
+	FParse::Value(*Params, TEXT("rooms="), GenParams.MaxRooms);
+	FParse::Value(*Params, TEXT("floors="), NumFloors);
+	FParse::Value(*Params, TEXT("seed="), Seed);
+	FParse::Value(*Params, TEXT("iterations="), Iterations);
+	FParse::Value(*Params, TEXT("groups="), NumGroups);
+	FParse::Value(*Params, TEXT("steps="), NumSteps);
+	Iterations = FMath::Max(1, Iterations);
+	NumFloors = FMath::Max(1, NumFloors);
+	NumSteps = FMath::Max(1, NumSteps);
+
+	UE_LOG(LogTemp, Display, TEXT("DungeonGenBenchmark: %dx%d, %d salas, %d andares, seed %d"),
+		GenParams.Width, GenParams.Height, GenParams.MaxRooms, NumFloors, Seed);
+
+	// Um andar, várias vezes (o layout é reutilizado como no jogo)
+	FDungeonFloorLayout Layout;
+	double BestMs = TNumericLimits<double>::Max();
+	double TotalMs = 0.0;
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		const double Start = FPlatformTime::Seconds();
+		FDungeonGenerator::Generate(GenParams, Seed, Layout);
+		const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
+		BestMs = FMath::Min(BestMs, Ms);
+		TotalMs += Ms;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("DungeonGenBenchmark: 1 andar: média %.3f ms, melhor %.3f ms, %d salas"),
+		TotalMs / Iterations, BestMs, Layout.Rooms.Num());
+
+	// Determinismo: mesma seed, mesmo grid
+	FDungeonFloorLayout Second;
+	FDungeonGenerator::Generate(GenParams, Seed, Second);
+	const bool bDeterministic = HashLayout(Layout) == HashLayout(Second);
+	UE_LOG(LogTemp, Display, TEXT("DungeonGenBenchmark: Determinístico: %s (crc %08x)"),
+		bDeterministic ? TEXT("sim") : TEXT("NÃO"), HashLayout(Layout));
+
+	// Sequencial vs paralelo
+	TArray<FDungeonFloorLayout> Sequential;
+	Sequential.SetNum(NumFloors);
+	double Start = FPlatformTime::Seconds();
+	for (int32 Floor = 0; Floor < NumFloors; Floor++)
+	{
+		FDungeonGenerator::Generate(GenParams, FDungeonGenerator::GetFloorSeed(Seed, Floor), Sequential[Floor]);
+	}
+	const double SequentialMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	TArray<FDungeonFloorLayout> Parallel;
+	Start = FPlatformTime::Seconds();
+	FDungeonGenerator::GenerateFloors(GenParams, Seed, NumFloors, Parallel);
+	const double ParallelMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	bool bParallelMatches = true;
+	for (int32 Floor = 0; Floor < NumFloors; Floor++)
+	{
+		bParallelMatches &= HashLayout(Sequential[Floor]) == HashLayout(Parallel[Floor]);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("DungeonGenBenchmark: %d andares: sequencial %.2f ms, paralelo %.2f ms (%.2fx), resultados iguais: %s"),
+		NumFloors, SequentialMs, ParallelMs, ParallelMs > 0.0 ? SequentialMs / ParallelMs : 0.0,
+		bParallelMatches ? TEXT("sim") : TEXT("NÃO"));
+
+	// Grupos de encontro no andar gerado: um Update por passo do jogador, contatos removidos como no jogo
+	if (Layout.Rooms.Num() > 0 && NumGroups > 0)
+	{
+		FRandomStream RoamingRandom(Seed);
+		FRoamingEncounterSystem Roaming;
+		Roaming.Initialize(Layout.Grid);
+		Roaming.Populate(NumGroups, 16, RoamingRandom);
+		const int32 StartGroups = Roaming.Num();
+
+		TArray<int32> Contacts;
+		int32 TotalContacts = 0;
+		double BestStepMs = TNumericLimits<double>::Max();
+		double WorstStepMs = 0.0;
+		Start = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < NumSteps; Step++)
+		{
+			// O jogador percorre os centros das salas (células de sala são caminháveis)
+			const FIntPoint PlayerCell = Layout.Rooms[Step % Layout.Rooms.Num()].Center();
+
+			const double StepStart = FPlatformTime::Seconds();
+			Roaming.Update(PlayerCell, RoamingRandom, Contacts);
+			for (int32 i = Contacts.Num() - 1; i >= 0; i--)
+			{
+				Roaming.RemoveGroup(Contacts[i]);
+			}
+			const double StepMs = (FPlatformTime::Seconds() - StepStart) * 1000.0;
+			BestStepMs = FMath::Min(BestStepMs, StepMs);
+			WorstStepMs = FMath::Max(WorstStepMs, StepMs);
+			TotalContacts += Contacts.Num();
+		}
+		const double RoamingMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		UE_LOG(LogTemp, Display, TEXT("DungeonGenBenchmark: Roaming: %d grupos, %d passos: média %.4f ms/passo (melhor %.4f, pior %.4f), %.1f ns/grupo, %d contatos"),
+			StartGroups, NumSteps, RoamingMs / NumSteps, BestStepMs, WorstStepMs,
+			StartGroups > 0 ? RoamingMs * 1000000.0 / ((double)StartGroups * NumSteps) : 0.0, TotalContacts);
+	}
+
+	return bDeterministic && bParallelMatches ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+// DungeonGenBenchmarkCommandlet.h
+// Benchmark do gerador procedural de andares
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DungeonGenBenchmarkCommandlet.generated.h"
+
+/**
+ * Mede o gerador de dungeons sem abrir mapa nenhum
+ * Uso: UnrealEditor-Cmd J.uproject -run=DungeonGenBenchmark [-width=256] [-height=256] [-floors=16] [-seed=1] [-iterations=20] [-groups=4000] [-steps=1000]
+ * Reporta o tempo por andar, o ganho da geração paralela e confere o determinismo pela seed.
+ * Também mede o Update dos grupos de encontro (roaming) sobre o andar gerado.
+ */
+UCLASS()
+class J_API UDungeonGenBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDungeonGenBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,330 @@
+// EncounterTunerCommandlet.cpp
+
+#include "EncounterTunerCommandlet.h"
+#include "Core/ParameterSearch.h"
+#include "Encounters/EncounterWalkSimulator.h"
+#include "Encounters/EncounterZoneMapAsset.h"
+#include "Combat/BattleSimulator.h"
+#include "Combat/CombatMath.h"
+#include "Combat/CombatantComponent.h"
+#include "Combat/EnemyBase.h"
+#include "Combat/EnemyDatabase.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace
+{
+	/** Configuração comum às duas buscas */
+	struct FTunerSettings
+	{
+		EParameterSearchMethod Method = EParameterSearchMethod::Evolution;
+		int32 Budget = 60;
+		int32 NumThreads = 0;
+		int32 Seed = 1;
+		bool bWrite = false;
+	};
+
+	/** Lista de DemonIDs separados por vírgula -> índices no banco */
+	bool ParseSide(const FEnemyDatabase& Database, const FString& List, TArray<int32>& OutIndices)
+	{
+		TArray<FString> Names;
+		List.ParseIntoArray(Names, TEXT(","));
+		for (const FString& Name : Names)
+		{
+			const int32 Index = Database.FindByDemonID(FName(*Name));
+			if (Index == INDEX_NONE)
+			{
+				UE_LOG(LogTemp, Error, TEXT("EncounterTuner: %s não está no banco de inimigos"), *Name);
+				return false;
+			}
+			OutIndices.Add(Index);
+		}
+		return OutIndices.Num() > 0;
+	}
+
+	bool SaveAssetPackage(UPackage* Package)
+	{
+#if WITH_EDITOR
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		const bool bSaved = UPackage::SavePackage(Package, nullptr, *Filename, SaveArgs);
+
+		UE_LOG(LogTemp, Display, TEXT("EncounterTuner: %s %s"), bSaved ? TEXT("Gravado") : TEXT("FALHA ao gravar"), *Filename);
+		return bSaved;
+#else
+		UE_LOG(LogTemp, Error, TEXT("EncounterTuner: Gravar assets requer o editor"));
+		return false;
+#endif
+	}
+
+	void LogResult(const TCHAR* Label, TConstArrayView<FSearchParameter> Parameters, const FParameterSearchResult& Result, double Seconds)
+	{
+		UE_LOG(LogTemp, Display, TEXT("EncounterTuner: [%s] %d avaliações em %.2f s, custo %.4f"),
+			Label, Result.NumEvaluations, Seconds, Result.Cost);
+		for (int32 i = 0; i < Parameters.Num() && i < Result.Values.Num(); i++)
+		{
+			UE_LOG(LogTemp, Display, TEXT("EncounterTuner:     %s = %.3f (era %.3f)"),
+				*Parameters[i].Name, Result.Values[i], Parameters[i].Start);
+		}
+	}
+
+	/** -steps: RateMultiplier e limites de passos da zona */
+	bool TuneEncounterRate(const FString& Params, float TargetSteps, const FTunerSettings& Settings)
+	{
+		FString ZoneMapPath;
+		FName ZoneID;
+		float BaseRate = 10.0f;
+		int64 NumWalks = 100000;
+		FParse::Value(*Params, TEXT("zonemap="), ZoneMapPath);
+		FParse::Value(*Params, TEXT("zone="), ZoneID);
+		FParse::Value(*Params, TEXT("baserate="), BaseRate);
+		FParse::Value(*Params, TEXT("walks="), NumWalks);
+		NumWalks = FMath::Max<int64>(1, NumWalks);
+
+		UEncounterZoneMapAsset* ZoneMap = nullptr;
+		FEncounterZone* Zone = nullptr;
+		if (!ZoneMapPath.IsEmpty())
+		{
+			ZoneMap = LoadObject<UEncounterZoneMapAsset>(nullptr, *ZoneMapPath);
+			Zone = ZoneMap ? ZoneMap->Zones.FindByPredicate([ZoneID](const FEncounterZone& Candidate) { return Candidate.ZoneID == ZoneID; }) : nullptr;
+			if (!Zone)
+			{
+				UE_LOG(LogTemp, Error, TEXT("EncounterTuner: Zona %s não encontrada em %s"), *ZoneID.ToString(), *ZoneMapPath);
+				return false;
+			}
+		}
+
+		FEncounterRateParams Current;
+		Current.BaseEncounterRate = BaseRate;
+		if (Zone)
+		{
+			Current.RateMultiplier = Zone->RateMultiplier;
+			Current.MinStepsBetweenEncounters = Zone->MinStepsBetweenEncounters;
+			Current.MaxStepsWithoutEncounter = Zone->MaxStepsWithoutEncounter;
+		}
+
+		const FEncounterWalkStats Before = FEncounterWalkSimulator::Run(Current, NumWalks, Settings.NumThreads, Settings.Seed);
+		UE_LOG(LogTemp, Display, TEXT("EncounterTuner: [Passos] Meta %.1f passos/encontro; atual %.2f (%.1f%% forçados)"),
+			TargetSteps, Before.GetAverageSteps(), Before.GetForcedRate() * 100.0);
+
+		const FSearchParameter Parameters[] =
+		{
+			{ TEXT("RateMultiplier"), 0.1, 4.0, Current.RateMultiplier, false },
+			{ TEXT("MinStepsBetweenEncounters"), 0.0, TargetSteps, (double)Current.MinStepsBetweenEncounters, true },
+			{ TEXT("MaxStepsWithoutEncounter"), 1.0, TargetSteps * 3.0, (double)Current.MaxStepsWithoutEncounter, true },
+		};
+
+		auto MakeCandidate = [&Current](TConstArrayView<double> Values)
+		{
+			FEncounterRateParams Candidate = Current;
+			Candidate.RateMultiplier = (float)Values[0];
+			Candidate.MinStepsBetweenEncounters = (int32)Values[1];
+			Candidate.MaxStepsWithoutEncounter = (int32)Values[2];
+			return Candidate;
+		};
+
+		auto Cost = [&](TConstArrayView<double> Values)
+		{
+			const FEncounterRateParams Candidate = MakeCandidate(Values);
+
+			// Máximo sem folga sobre o mínimo = sem progressão; penalidade proporcional à inversão
+			if (Candidate.MaxStepsWithoutEncounter <= Candidate.MinStepsBetweenEncounters)
+			{
+				return 10.0 + Candidate.MinStepsBetweenEncounters - Candidate.MaxStepsWithoutEncounter;
+			}
+
+			// Mesma seed para todos os candidatos (números aleatórios comuns)
+			const FEncounterWalkStats Stats = FEncounterWalkSimulator::Run(Candidate, NumWalks, Settings.NumThreads, Settings.Seed);
+
+			// Erro relativo da média; encontros forçados pesam pouco, só para preferir a curva à garantia
+			return FMath::Abs(Stats.GetAverageSteps() - TargetSteps) / TargetSteps + 0.1 * Stats.GetForcedRate();
+		};
+
+		const double Start = FPlatformTime::Seconds();
+		const FParameterSearchResult Result = FParameterSearch::Minimize(Parameters, Cost, Settings.Method, Settings.Budget, Settings.Seed);
+		LogResult(TEXT("Passos"), Parameters, Result, FPlatformTime::Seconds() - Start);
+
+		const FEncounterRateParams Best = MakeCandidate(Result.Values);
+		const FEncounterWalkStats After = FEncounterWalkSimulator::Run(Best, NumWalks, Settings.NumThreads, Settings.Seed);
+		UE_LOG(LogTemp, Display, TEXT("EncounterTuner: [Passos] Resultado %.2f passos/encontro (%.1f%% forçados)"),
+			After.GetAverageSteps(), After.GetForcedRate() * 100.0);
+
+		if (!Settings.bWrite)
+		{
+			return true;
+		}
+		if (!Zone)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("EncounterTuner: -write sem -zonemap/-zone; nada gravado"));
+			return true;
+		}
+
+		ZoneMap->Modify();
+		Zone->RateMultiplier = Best.RateMultiplier;
+		Zone->MinStepsBetweenEncounters = Best.MinStepsBetweenEncounters;
+		Zone->MaxStepsWithoutEncounter = Best.MaxStepsWithoutEncounter;
+		return SaveAssetPackage(ZoneMap->GetOutermost());
+	}
+
+	/** Grava os stats escalados nos CDOs e atualiza o banco assado */
+	bool WriteEnemyStats(FEnemyDatabase& Database, const TArray<int32>& Enemies, int32 StatPermille)
+	{
+		TArray<int32> Archetypes;
+		for (int32 Index : Enemies)
+		{
+			Archetypes.AddUnique(Index);
+		}
+
+		bool bSuccess = true;
+		for (int32 Index : Archetypes)
+		{
+			const FName ClassPath = Database.GetClassPath(Index);
+			UClass* EnemyClass = ClassPath.IsNone() ? nullptr : LoadObject<UClass>(nullptr, *ClassPath.ToString());
+			AEnemyBase* Defaults = EnemyClass ? EnemyClass->GetDefaultObject<AEnemyBase>() : nullptr;
+			UPackage* Package = EnemyClass ? EnemyClass->GetOutermost() : nullptr;
+
+			// Classes nativas não têm asset onde gravar
+			if (!Defaults || !Defaults->Combatant || Package->HasAnyPackageFlags(PKG_CompiledIn))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("EncounterTuner: %s não é um Blueprint gravável, ignorado"), *Database.GetDemonID(Index).ToString());
+				bSuccess = false;
+				continue;
+			}
+
+			// Mesma regra de escala usada na simulação
+			const FEnemyRecord Scaled = FBattleSimulator::ScaleEnemyRecord(Database.GetRecord(Index), StatPermille);
+
+			UCombatantComponent* Combatant = Defaults->Combatant;
+			Combatant->Modify();
+			Combatant->Stats.MaxHP = Scaled.MaxHP;
+			Combatant->Stats.CurrentHP = Scaled.MaxHP;
+			Combatant->Stats.Strength = Scaled.Strength;
+			Combatant->Stats.Magic = Scaled.Magic;
+			Combatant->Stats.Vitality = Scaled.Vitality;
+			Combatant->Stats.Agility = Scaled.Agility;
+			Combatant->Stats.Luck = Scaled.Luck;
+
+			Database.AddArchetype(*Defaults);
+			bSuccess &= SaveAssetPackage(Package);
+		}
+
+		const FString DatabasePath = FEnemyDatabase::GetDefaultPath();
+		if (!Database.SaveToFile(DatabasePath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("EncounterTuner: Falha ao gravar %s"), *DatabasePath);
+			return false;
+		}
+		return bSuccess;
+	}
+
+	/** -winrate: escala de HP/stats dos inimigos */
+	bool TuneEnemyStats(const FString& Params, float TargetWinRate, const FTunerSettings& Settings)
+	{
+		FString PartyList;
+		FString EnemyList;
+		FString FormulaName = TEXT("Classic");
+		int64 NumBattles = 20000;
+		FParse::Value(*Params, TEXT("party="), PartyList, false);
+		FParse::Value(*Params, TEXT("enemies="), EnemyList, false);
+		FParse::Value(*Params, TEXT("formula="), FormulaName);
+		FParse::Value(*Params, TEXT("battles="), NumBattles);
+		NumBattles = FMath::Max<int64>(1, NumBattles);
+
+		FEnemyDatabase Database;
+		if (!Database.LoadFromFile(FEnemyDatabase::GetDefaultPath()))
+		{
+			UE_LOG(LogTemp, Error, TEXT("EncounterTuner: Sem EnemyDatabase.bin; rode -run=BakeEnemyDatabase antes"));
+			return false;
+		}
+
+		FBattleSimConfig Config;
+		const int64 FormulaValue = StaticEnum<EDamageFormula>()->GetValueByNameString(FormulaName);
+		Config.Formula = FormulaValue != INDEX_NONE ? (EDamageFormula)FormulaValue : EDamageFormula::Classic;
+		if (!ParseSide(Database, PartyList, Config.Party) || !ParseSide(Database, EnemyList, Config.Enemies))
+		{
+			UE_LOG(LogTemp, Error, TEXT("EncounterTuner: -winrate requer -party= e -enemies="));
+			return false;
+		}
+
+		const FBattleSimStats Before = FBattleSimulator::Run(Database, Config, NumBattles, Settings.NumThreads, Settings.Seed);
+		UE_LOG(LogTemp, Display, TEXT("EncounterTuner: [Vitórias] Meta %.1f%%; atual %.2f%% (%d vs %d, %s)"),
+			TargetWinRate, Before.GetWinRate() * 100.0, Config.Party.Num(), Config.Enemies.Num(), *UEnum::GetValueAsString(Config.Formula));
+
+		const FSearchParameter Parameters[] =
+		{
+			{ TEXT("EnemyStatPermille"), 250.0, 3000.0, (double)FCombatMath::One, true },
+		};
+
+		auto Cost = [&](TConstArrayView<double> Values)
+		{
+			FBattleSimConfig Candidate = Config;
+			Candidate.EnemyStatPermille = (int32)Values[0];
+
+			const FBattleSimStats Stats = FBattleSimulator::Run(Database, Candidate, NumBattles, Settings.NumThreads, Settings.Seed);
+			return FMath::Abs(Stats.GetWinRate() * 100.0 - TargetWinRate) / 100.0;
+		};
+
+		const double Start = FPlatformTime::Seconds();
+		const FParameterSearchResult Result = FParameterSearch::Minimize(Parameters, Cost, Settings.Method, Settings.Budget, Settings.Seed);
+		LogResult(TEXT("Vitórias"), Parameters, Result, FPlatformTime::Seconds() - Start);
+
+		FBattleSimConfig Best = Config;
+		Best.EnemyStatPermille = (int32)Result.Values[0];
+		const FBattleSimStats After = FBattleSimulator::Run(Database, Best, NumBattles, Settings.NumThreads, Settings.Seed);
+		UE_LOG(LogTemp, Display, TEXT("EncounterTuner: [Vitórias] Inimigos a %.1f%% dos stats: %.2f%% de vitórias, %.2f rodadas/batalha"),
+			Best.EnemyStatPermille / 10.0, After.GetWinRate() * 100.0, After.GetAverageRounds());
+
+		return Settings.bWrite ? WriteEnemyStats(Database, Config.Enemies, Best.EnemyStatPermille) : true;
+	}
+}
+
+UEncounterTunerCommandlet::UEncounterTunerCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UEncounterTunerCommandlet::Main(const FString& Params)
+{
+	FTunerSettings Settings;
+	FString MethodName = TEXT("Evolution");
+	float TargetSteps = 0.0f;
+	float TargetWinRate = 0.0f;
+
+	FParse::Value(*Params, TEXT("method="), MethodName);
+	FParse::Value(*Params, TEXT("budget="), Settings.Budget);
+	FParse::Value(*Params, TEXT("threads="), Settings.NumThreads);
+	FParse::Value(*Params, TEXT("seed="), Settings.Seed);
+	FParse::Value(*Params, TEXT("steps="), TargetSteps);
+	FParse::Value(*Params, TEXT("winrate="), TargetWinRate);
+	Settings.bWrite = FParse::Param(*Params, TEXT("write"));
+
+	if (!FParameterSearch::ParseMethod(MethodName, Settings.Method))
+	{
+		UE_LOG(LogTemp, Error, TEXT("EncounterTuner: Método desconhecido %s (Grid, Random, Evolution)"), *MethodName);
+		return 1;
+	}
+
+	if (TargetSteps <= 0.0f && TargetWinRate <= 0.0f)
+	{
+		UE_LOG(LogTemp, Error, TEXT("EncounterTuner: Nada a ajustar; use -steps= e/ou -winrate="));
+		return 1;
+	}
+
+	bool bSuccess = true;
+	if (TargetSteps > 0.0f)
+	{
+		bSuccess &= TuneEncounterRate(Params, TargetSteps, Settings);
+	}
+	if (TargetWinRate > 0.0f)
+	{
+		bSuccess &= TuneEnemyStats(Params, FMath::Clamp(TargetWinRate, 0.0f, 100.0f), Settings);
+	}
+
+	return bSuccess ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+// EncounterTunerCommandlet.h
+// Ajuste automático de taxa de encontros e força dos inimigos
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EncounterTunerCommandlet.generated.h"
+
+/**
+ * Busca parâmetros que atinjam metas de balanceamento por simulação
+ * Uso: UnrealEditor-Cmd J.uproject -run=EncounterTuner [-method=Grid|Random|Evolution] [-budget=60]
+ *      [-threads=T] [-seed=1]
+ *      [-steps=25 -zonemap=/Game/Dungeon/ZM_Floor1.ZM_Floor1 -zone=Zona1 -baserate=10 -walks=100000]
+ *      [-winrate=60 -party=DemonA,DemonB -enemies=DemonC,DemonC -formula=Classic -battles=20000]
+ *      [-write]
+ *
+ * -steps: média de passos por encontro. Ajusta RateMultiplier, MinStepsBetweenEncounters e
+ *   MaxStepsWithoutEncounter da zona com o FEncounterWalkSimulator (BaseEncounterRate fica
+ *   no URandomEncounterManager e entra como constante).
+ * -winrate: porcentagem de vitórias da party. Ajusta a escala de HP/stats dos inimigos
+ *   com o FBattleSimulator (a party define o nível da meta).
+ * -write: grava a zona no asset e os stats escalados nos CDOs dos inimigos, e atualiza
+ *   o EnemyDatabase.bin.
+ */
+UCLASS()
+class J_API UEncounterTunerCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEncounterTunerCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,56 @@
+// DemonCompendiumAsset.h
+// Tabela com os metadados de todos os demônios do compêndio
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Core/RPGTypes.h"
+#include "DemonCompendiumAsset.generated.h"
+
+class AEnemyBase;
+class UTexture2D;
+
+/**
+ * Linha do compêndio
+ * Sprites e classes são referências soft: nada é carregado junto com a tabela.
+ */
+USTRUCT(BlueprintType)
+struct FDemonCompendiumEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	FName DemonID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	FText Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	FText Description;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	EDemonRace Race = EDemonRace::Beast;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	int32 Level = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	TSoftObjectPtr<UTexture2D> Sprite;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	TSoftClassPtr<AEnemyBase> DemonClass;
+};
+
+/**
+ * Compêndio de demônios (dados estáticos)
+ */
+UCLASS(BlueprintType)
+class J_API UDemonCompendiumAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Compendium")
+	TArray<FDemonCompendiumEntry> Entries;
+};
@@ -0,0 +1,158 @@
+// DemonCompendiumSubsystem.cpp
+
+#include "DemonCompendiumSubsystem.h"
+#include "Core/JGameInstance.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/Texture2D.h"
+
+void UDemonCompendiumSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// A tabela é pequena (sem texturas), pode ser carregada direto
+	if (const UJGameInstance* GameInstance = Cast<UJGameInstance>(GetGameInstance()))
+	{
+		if (!GameInstance->DemonCompendium.IsNull())
+		{
+			SetCompendium(GameInstance->DemonCompendium.LoadSynchronous());
+		}
+	}
+}
+
+void UDemonCompendiumSubsystem::Deinitialize()
+{
+	ReleaseAllThumbnails();
+	Super::Deinitialize();
+}
+
+void UDemonCompendiumSubsystem::SetCompendium(UDemonCompendiumAsset* InCompendium)
+{
+	ReleaseAllThumbnails();
+
+	Compendium = InCompendium;
+	EntryIndexByID.Reset();
+	RecordedEntries.Init(false, GetNumEntries());
+
+	if (Compendium)
+	{
+		EntryIndexByID.Reserve(Compendium->Entries.Num());
+		for (int32 i = 0; i < Compendium->Entries.Num(); i++)
+		{
+			EntryIndexByID.Add(Compendium->Entries[i].DemonID, i);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("DemonCompendium: %d demônios no compêndio"), Compendium->Entries.Num());
+	}
+}
+
+int32 UDemonCompendiumSubsystem::FindEntryIndex(FName DemonID) const
+{
+	const int32* Index = EntryIndexByID.Find(DemonID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+bool UDemonCompendiumSubsystem::GetEntry(int32 EntryIndex, FDemonCompendiumEntry& OutEntry) const
+{
+	if (!Compendium || !Compendium->Entries.IsValidIndex(EntryIndex))
+	{
+		return false;
+	}
+
+	OutEntry = Compendium->Entries[EntryIndex];
+	return true;
+}
+
+void UDemonCompendiumSubsystem::RecordDemon(FName DemonID)
+{
+	const int32 Index = FindEntryIndex(DemonID);
+	if (Index == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DemonCompendium: %s não está no compêndio"), *DemonID.ToString());
+		return;
+	}
+
+	if (!RecordedEntries[Index])
+	{
+		RecordedEntries[Index] = true;
+		UE_LOG(LogTemp, Log, TEXT("DemonCompendium: %s registrado"), *DemonID.ToString());
+	}
+}
+
+// ==================== MINIATURAS ====================
+
+void UDemonCompendiumSubsystem::SetVisibleRange(int32 FirstIndex, int32 Count)
+{
+	const int32 NumEntries = GetNumEntries();
+	const int32 NewStart = FMath::Clamp(FirstIndex - ThumbnailWindowMargin, 0, NumEntries);
+	const int32 NewEnd = FMath::Clamp(FirstIndex + Count + ThumbnailWindowMargin, NewStart, NumEntries);
+
+	if (NewStart == WindowStart && NewEnd == WindowEnd)
+	{
+		return;
+	}
+
+	// Liberar o que saiu da janela
+	for (auto It = ThumbnailHandles.CreateIterator(); It; ++It)
+	{
+		if (It.Key() < NewStart || It.Key() >= NewEnd)
+		{
+			if (It.Value().IsValid())
+			{
+				It.Value()->ReleaseHandle();
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	WindowStart = NewStart;
+	WindowEnd = NewEnd;
+
+	// Pedir o que entrou na janela
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	for (int32 Index = WindowStart; Index < WindowEnd; Index++)
+	{
+		const TSoftObjectPtr<UTexture2D>& Sprite = Compendium->Entries[Index].Sprite;
+		if (Sprite.IsNull() || ThumbnailHandles.Contains(Index))
+		{
+			continue;
+		}
+
+		ThumbnailHandles.Add(Index, Streamable.RequestAsyncLoad(Sprite.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UDemonCompendiumSubsystem::HandleThumbnailLoaded, Index)));
+	}
+}
+
+UTexture2D* UDemonCompendiumSubsystem::GetThumbnail(int32 EntryIndex) const
+{
+	// Só devolve miniaturas mantidas pela janela atual
+	if (!ThumbnailHandles.Contains(EntryIndex))
+	{
+		return nullptr;
+	}
+	return Compendium->Entries[EntryIndex].Sprite.Get();
+}
+
+void UDemonCompendiumSubsystem::HandleThumbnailLoaded(int32 EntryIndex)
+{
+	// A linha pode ter saído da janela antes do load terminar
+	if (UTexture2D* Thumbnail = GetThumbnail(EntryIndex))
+	{
+		OnThumbnailLoaded.Broadcast(EntryIndex, Thumbnail);
+	}
+}
+
+void UDemonCompendiumSubsystem::ReleaseAllThumbnails()
+{
+	for (TPair<int32, TSharedPtr<FStreamableHandle>>& Pair : ThumbnailHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->ReleaseHandle();
+		}
+	}
+
+	ThumbnailHandles.Reset();
+	WindowStart = 0;
+	WindowEnd = 0;
+}
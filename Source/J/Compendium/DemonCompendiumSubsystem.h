@@ -0,0 +1,102 @@
+// DemonCompendiumSubsystem.h
+// Registro do compêndio: demônios registrados e streaming de miniaturas
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "DemonCompendiumAsset.h"
+#include "DemonCompendiumSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCompendiumThumbnailLoaded, int32, EntryIndex, UTexture2D*, Thumbnail);
+
+/**
+ * Registro do compêndio de demônios
+ * Os metadados ficam no UDemonCompendiumAsset; aqui guardamos apenas um bit
+ * por demônio registrado. Sprites são carregados de forma assíncrona só para
+ * a janela visível da lista e liberados quando saem dela, então a memória
+ * não cresce com o número de demônios registrados.
+ */
+UCLASS()
+class J_API UDemonCompendiumSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// ==================== CONFIGURAÇÃO ====================
+
+	/** Define a tabela do compêndio (reinicia os registros) */
+	UFUNCTION(BlueprintCallable, Category = "Compendium")
+	void SetCompendium(UDemonCompendiumAsset* InCompendium);
+
+	/** Quantas linhas além da janela visível manter carregadas */
+	UPROPERTY(BlueprintReadWrite, Category = "Compendium")
+	int32 ThumbnailWindowMargin = 8;
+
+	// ==================== CONSULTA ====================
+
+	UFUNCTION(BlueprintPure, Category = "Compendium")
+	int32 GetNumEntries() const { return Compendium ? Compendium->Entries.Num() : 0; }
+
+	/** Índice de um demônio no compêndio, ou INDEX_NONE */
+	UFUNCTION(BlueprintPure, Category = "Compendium")
+	int32 FindEntryIndex(FName DemonID) const;
+
+	/** Metadados de uma linha */
+	UFUNCTION(BlueprintPure, Category = "Compendium")
+	bool GetEntry(int32 EntryIndex, FDemonCompendiumEntry& OutEntry) const;
+
+	// ==================== REGISTRO ====================
+
+	/** Registra um demônio (recrutado, fundido...) */
+	UFUNCTION(BlueprintCallable, Category = "Compendium")
+	void RecordDemon(FName DemonID);
+
+	UFUNCTION(BlueprintPure, Category = "Compendium")
+	bool IsRecorded(int32 EntryIndex) const { return RecordedEntries.IsValidIndex(EntryIndex) && RecordedEntries[EntryIndex]; }
+
+	UFUNCTION(BlueprintPure, Category = "Compendium")
+	int32 GetNumRecorded() const { return RecordedEntries.CountSetBits(); }
+
+	// ==================== MINIATURAS ====================
+
+	/**
+	 * Informa a faixa visível da lista (chamar ao rolar).
+	 * Carrega as miniaturas da faixa (+ margem) e libera as que saíram dela.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Compendium")
+	void SetVisibleRange(int32 FirstIndex, int32 Count);
+
+	/** Miniatura já carregada (nullptr enquanto o streaming não terminou) */
+	UFUNCTION(BlueprintPure, Category = "Compendium")
+	UTexture2D* GetThumbnail(int32 EntryIndex) const;
+
+	/** Disparado quando uma miniatura da janela termina de carregar */
+	UPROPERTY(BlueprintAssignable, Category = "Compendium")
+	FOnCompendiumThumbnailLoaded OnThumbnailLoaded;
+
+private:
+	void HandleThumbnailLoaded(int32 EntryIndex);
+	void ReleaseAllThumbnails();
+
+	UPROPERTY(Transient)
+	UDemonCompendiumAsset* Compendium = nullptr;
+
+	/** DemonID -> linha */
+	TMap<FName, int32> EntryIndexByID;
+
+	/** Um bit por linha do compêndio */
+	TBitArray<> RecordedEntries;
+
+	/** Janela carregada [WindowStart, WindowEnd) */
+	int32 WindowStart = 0;
+	int32 WindowEnd = 0;
+
+	/** Handles de streaming apenas das linhas dentro da janela */
+	TMap<int32, TSharedPtr<FStreamableHandle>> ThumbnailHandles;
+};
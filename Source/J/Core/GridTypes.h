@@ -0,0 +1,51 @@
+// GridTypes.h
+// Conversões entre mundo, células e chunks do grid de exploração
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Matemática do grid de exploração
+ * A célula (0,0) fica na origem do mundo; SnapToGrid arredonda para múltiplos
+ * de GridCellSize, então a célula é a posição dividida e arredondada.
+ */
+struct FGridMath
+{
+	/** Célula que contém a posição */
+	static FORCEINLINE FIntPoint WorldToCell(const FVector& Location, float CellSize)
+	{
+		return FIntPoint(FMath::RoundToInt(Location.X / CellSize), FMath::RoundToInt(Location.Y / CellSize));
+	}
+
+	/** Centro da célula no mundo */
+	static FORCEINLINE FVector CellToWorld(FIntPoint Cell, float CellSize, float Z = 0.0f)
+	{
+		return FVector(Cell.X * CellSize, Cell.Y * CellSize, Z);
+	}
+
+	/** Chunk que contém a célula (divisão arredondada para baixo, válida para negativos) */
+	static FORCEINLINE FIntPoint CellToChunk(FIntPoint Cell, int32 ChunkSize)
+	{
+		return FIntPoint(FMath::DivideAndRoundDown(Cell.X, ChunkSize), FMath::DivideAndRoundDown(Cell.Y, ChunkSize));
+	}
+
+	/** Deslocamento de uma célula para a direção 0-3 (+X, +Y, -X, -Y; mesma ordem do yaw) */
+	static FORCEINLINE FIntPoint FacingToCellStep(int32 Facing)
+	{
+		static const FIntPoint Steps[4] = { FIntPoint(1, 0), FIntPoint(0, 1), FIntPoint(-1, 0), FIntPoint(0, -1) };
+		return Steps[Facing & 3];
+	}
+
+	/** Direção 0-3 mais próxima do yaw */
+	static FORCEINLINE int32 YawToFacing(float Yaw)
+	{
+		return FMath::RoundToInt(FRotator::NormalizeAxis(Yaw) / 90.0f) & 3;
+	}
+
+	/** Deslocamento de uma célula na direção do yaw (múltiplos de 90 graus) */
+	static FORCEINLINE FIntPoint YawToCellStep(float Yaw)
+	{
+		return FacingToCellStep(YawToFacing(Yaw));
+	}
+};
@@ -1,6 +1,24 @@
 // JGameInstance.cpp
 
 #include "JGameInstance.h"
+#include "Items/InventorySubsystem.h"
+#include "Dungeon/AutomapSubsystem.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	constexpr uint32 GameSaveMagic = 0x4A534156; // "JSAV"
+	/** Stats do jogador + blocos do inventário e do automapa (cada um com a própria versão) */
+	constexpr uint32 GameSaveVersion = 1;
+
+	FString GetGameSavePath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("JSave.bin");
+	}
+}
 
 UJGameInstance::UJGameInstance()
 {
@@ -12,12 +30,103 @@ UJGameInstance::UJGameInstance()
 
 void UJGameInstance::SaveGame()
 {
-	// TODO: Implementar sistema de save
-	UE_LOG(LogTemp, Log, TEXT("JGameInstance: Salvando jogo..."));
+	UInventorySubsystem* Inventory = GetSubsystem<UInventorySubsystem>();
+	UAutomapSubsystem* Automap = GetSubsystem<UAutomapSubsystem>();
+
+	TArray<uint8> InventoryBytes;
+	TArray<uint8> AutomapBytes;
+	if (Inventory)
+	{
+		Inventory->SaveToBytes(InventoryBytes);
+	}
+	if (Automap)
+	{
+		Automap->SaveToBytes(AutomapBytes);
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = GameSaveMagic;
+	uint32 Version = GameSaveVersion;
+	Writer << Magic;
+	Writer << Version;
+	Writer << PlayerLevel;
+	Writer << PlayerExperience;
+	Writer << PlayerGold;
+	Writer << InventoryBytes;
+	Writer << AutomapBytes;
+
+	const FString Path = GetGameSavePath();
+	if (FFileHelper::SaveArrayToFile(Bytes, *Path))
+	{
+		UE_LOG(LogTemp, Log, TEXT("JGameInstance: Jogo salvo em %s (%d bytes)"), *Path, Bytes.Num());
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("JGameInstance: Falha ao salvar em %s"), *Path);
+	}
 }
 
 void UJGameInstance::LoadGame()
 {
-	// TODO: Implementar sistema de load
-	UE_LOG(LogTemp, Log, TEXT("JGameInstance: Carregando jogo..."));
+	const FString Path = GetGameSavePath();
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+	{
+		UE_LOG(LogTemp, Log, TEXT("JGameInstance: Nenhum save em %s"), *Path);
+		return;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 LoadedLevel = 0;
+	int32 LoadedExperience = 0;
+	int32 LoadedGold = 0;
+	TArray<uint8> InventoryBytes;
+	TArray<uint8> AutomapBytes;
+
+	Reader << Magic;
+	Reader << Version;
+	if (Reader.IsError() || Magic != GameSaveMagic || Version != GameSaveVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("JGameInstance: Save inválido (versão %u)"), Version);
+		return;
+	}
+
+	Reader << LoadedLevel;
+	Reader << LoadedExperience;
+	Reader << LoadedGold;
+	Reader << InventoryBytes;
+	Reader << AutomapBytes;
+
+	// Validar o arquivo inteiro antes de tocar no estado atual
+	if (Reader.IsError() || !Reader.AtEnd())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("JGameInstance: Save corrompido"));
+		return;
+	}
+
+	// Inventário primeiro: um bloco inválido deixa o inventário atual intacto e aborta o load
+	UInventorySubsystem* Inventory = GetSubsystem<UInventorySubsystem>();
+	if (Inventory && !Inventory->LoadFromBytes(InventoryBytes))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("JGameInstance: Inventário do save rejeitado"));
+		return;
+	}
+
+	UAutomapSubsystem* Automap = GetSubsystem<UAutomapSubsystem>();
+	if (Automap && !Automap->LoadFromBytes(AutomapBytes))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("JGameInstance: Automapa do save rejeitado"));
+	}
+
+	PlayerLevel = LoadedLevel;
+	PlayerExperience = LoadedExperience;
+	PlayerGold = LoadedGold;
+
+	UE_LOG(LogTemp, Log, TEXT("JGameInstance: Jogo carregado de %s"), *Path);
 }
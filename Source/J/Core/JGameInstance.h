@@ -7,6 +7,9 @@
 #include "Engine/GameInstance.h"
 #include "JGameInstance.generated.h"
 
+class UDemonCompendiumAsset;
+class UItemDatabaseAsset;
+
 /**
  * GameInstance para manter dados persistentes do RPG
  * Estatísticas do jogador, inventário, progresso, etc.
@@ -29,7 +32,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Player Stats")
 	int32 PlayerGold = 100;
 
-	// Função para salvar/carregar progresso (implementar depois)
+	// Dados do jogo
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Data")
+	TSoftObjectPtr<UDemonCompendiumAsset> DemonCompendium;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Game Data")
+	TSoftObjectPtr<UItemDatabaseAsset> ItemDatabase;
+
+	// Salva/carrega stats, inventário e automapa (Saved/SaveGames/JSave.bin)
 	UFUNCTION(BlueprintCallable, Category = "Save System")
 	void SaveGame();
 
@@ -2,6 +2,7 @@
 
 #include "JGameMode.h"
 #include "Characters/FirstPersonRPGCharacter.h"
+#include "Dungeon/DungeonStreamingSubsystem.h"
 #include "UObject/ConstructorHelpers.h"
 
 AJGameMode::AJGameMode()
@@ -13,6 +14,11 @@ AJGameMode::AJGameMode()
 void AJGameMode::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (StartingFloor)
+	{
+		GetWorld()->GetSubsystem<UDungeonStreamingSubsystem>()->SetFloor(StartingFloor);
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("JGameMode: Jogo iniciado!"));
 }
@@ -7,6 +7,8 @@
 #include "GameFramework/GameModeBase.h"
 #include "JGameMode.generated.h"
 
+class UDungeonFloorAsset;
+
 /**
  * GameMode principal do jogo RPG estilo SMT
  * Controla as regras gerais do jogo, spawn de jogadores, etc.
@@ -19,6 +21,10 @@ class J_API AJGameMode : public AGameModeBase
 public:
 	AJGameMode();
 
+	/** Andar de dungeon carregado ao iniciar o mapa (nullptr = mapa sem streaming) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon")
+	UDungeonFloorAsset* StartingFloor = nullptr;
+
 protected:
 	virtual void BeginPlay() override;
 };
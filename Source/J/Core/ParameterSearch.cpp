@@ -0,0 +1,186 @@
+// ParameterSearch.cpp
+
+#include "ParameterSearch.h"
+
+namespace
+{
+	/** Busca no cubo [0, 1]^D; só o custo vê os valores reais */
+	struct FNormalizedSearch
+	{
+		TConstArrayView<FSearchParameter> Parameters;
+		FParameterSearch::FCostFunction Cost;
+		FParameterSearchResult Result;
+		TArray<double> Values;
+
+		FNormalizedSearch(TConstArrayView<FSearchParameter> InParameters, FParameterSearch::FCostFunction InCost)
+			: Parameters(InParameters)
+			, Cost(InCost)
+		{
+			Values.SetNumZeroed(Parameters.Num());
+		}
+
+		double ToValue(int32 Index, double Unit) const
+		{
+			const FSearchParameter& Parameter = Parameters[Index];
+			const double Value = Parameter.Min + FMath::Clamp(Unit, 0.0, 1.0) * (Parameter.Max - Parameter.Min);
+			return Parameter.bInteger ? FMath::RoundToDouble(Value) : Value;
+		}
+
+		double ToUnit(int32 Index, double Value) const
+		{
+			const FSearchParameter& Parameter = Parameters[Index];
+			const double Range = Parameter.Max - Parameter.Min;
+			return Range > 0.0 ? FMath::Clamp((Value - Parameter.Min) / Range, 0.0, 1.0) : 0.0;
+		}
+
+		/** Avalia o ponto e guarda se for o melhor até agora */
+		double Evaluate(TConstArrayView<double> Unit)
+		{
+			for (int32 i = 0; i < Parameters.Num(); i++)
+			{
+				Values[i] = ToValue(i, Unit[i]);
+			}
+
+			const double PointCost = Cost(Values);
+			Result.NumEvaluations++;
+			if (PointCost < Result.Cost)
+			{
+				Result.Cost = PointCost;
+				Result.Values = Values;
+			}
+			return PointCost;
+		}
+	};
+
+	/** Normal padrão (Box-Muller) a partir do FRandomStream */
+	double Gaussian(const FRandomStream& Random)
+	{
+		const double U1 = FMath::Max(1e-12, (double)Random.GetFraction());
+		const double U2 = Random.GetFraction();
+		return FMath::Sqrt(-2.0 * FMath::Loge(U1)) * FMath::Cos(2.0 * UE_DOUBLE_PI * U2);
+	}
+}
+
+FParameterSearchResult FParameterSearch::Minimize(TConstArrayView<FSearchParameter> Parameters, FCostFunction Cost,
+	EParameterSearchMethod Method, int32 Budget, int32 Seed)
+{
+	FNormalizedSearch Search(Parameters, Cost);
+	const int32 NumDims = Parameters.Num();
+	Budget = FMath::Max(1, Budget);
+	if (NumDims == 0)
+	{
+		return Search.Result;
+	}
+
+	FRandomStream Random(Seed);
+	TArray<double> Unit;
+	Unit.SetNumZeroed(NumDims);
+
+	switch (Method)
+	{
+	case EParameterSearchMethod::Grid:
+	{
+		// Pontos por eixo tais que PointsPerAxis^D <= Budget (mínimo 2: os extremos)
+		const int32 PointsPerAxis = FMath::Max(2, FMath::FloorToInt(FMath::Pow((double)Budget, 1.0 / NumDims) + 1e-9));
+
+		TArray<int32> Cursor;
+		Cursor.SetNumZeroed(NumDims);
+		for (;;)
+		{
+			for (int32 i = 0; i < NumDims; i++)
+			{
+				Unit[i] = (double)Cursor[i] / (PointsPerAxis - 1);
+			}
+			Search.Evaluate(Unit);
+
+			// Próximo ponto da grade (contador em base PointsPerAxis)
+			int32 Axis = 0;
+			while (Axis < NumDims && ++Cursor[Axis] == PointsPerAxis)
+			{
+				Cursor[Axis++] = 0;
+			}
+			if (Axis == NumDims)
+			{
+				break;
+			}
+		}
+		break;
+	}
+
+	case EParameterSearchMethod::Random:
+	{
+		for (int32 Evaluation = 0; Evaluation < Budget; Evaluation++)
+		{
+			for (int32 i = 0; i < NumDims; i++)
+			{
+				Unit[i] = Random.GetFraction();
+			}
+			Search.Evaluate(Unit);
+		}
+		break;
+	}
+
+	case EParameterSearchMethod::Evolution:
+	{
+		// (1+1)-ES: um pai, um filho por geração; o passo cresce no sucesso e
+		// encolhe na falha de forma que ~1/5 dos filhos sejam aceitos
+		constexpr double SuccessFactor = 1.5;
+		const double FailureFactor = FMath::Pow(SuccessFactor, -0.25);
+
+		TArray<double> Parent;
+		Parent.SetNumZeroed(NumDims);
+		for (int32 i = 0; i < NumDims; i++)
+		{
+			Parent[i] = Search.ToUnit(i, Parameters[i].Start);
+		}
+
+		double ParentCost = Search.Evaluate(Parent);
+		double Sigma = 0.25;
+
+		for (int32 Evaluation = 1; Evaluation < Budget; Evaluation++)
+		{
+			for (int32 i = 0; i < NumDims; i++)
+			{
+				Unit[i] = FMath::Clamp(Parent[i] + Sigma * Gaussian(Random), 0.0, 1.0);
+			}
+
+			const double ChildCost = Search.Evaluate(Unit);
+			if (ChildCost <= ParentCost)
+			{
+				Parent = Unit;
+				ParentCost = ChildCost;
+				Sigma *= SuccessFactor;
+			}
+			else
+			{
+				Sigma *= FailureFactor;
+			}
+			Sigma = FMath::Clamp(Sigma, 0.002, 0.5);
+		}
+		break;
+	}
+	}
+
+	return Search.Result;
+}
+
+bool FParameterSearch::ParseMethod(const FString& Name, EParameterSearchMethod& OutMethod)
+{
+	if (Name.Equals(TEXT("Grid"), ESearchCase::IgnoreCase))
+	{
+		OutMethod = EParameterSearchMethod::Grid;
+	}
+	else if (Name.Equals(TEXT("Random"), ESearchCase::IgnoreCase))
+	{
+		OutMethod = EParameterSearchMethod::Random;
+	}
+	else if (Name.Equals(TEXT("Evolution"), ESearchCase::IgnoreCase))
+	{
+		OutMethod = EParameterSearchMethod::Evolution;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
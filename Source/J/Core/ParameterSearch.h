@@ -0,0 +1,59 @@
+// ParameterSearch.h
+// Busca de parâmetros sem derivadas para as ferramentas de balanceamento
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Um parâmetro a ajustar e sua faixa
+ */
+struct FSearchParameter
+{
+	FString Name;
+	double Min = 0.0;
+	double Max = 1.0;
+
+	/** Valor inicial (o do asset); ponto de partida da busca evolutiva */
+	double Start = 0.0;
+
+	/** Arredondar para inteiro (passos, permilagens...) */
+	bool bInteger = false;
+};
+
+enum class EParameterSearchMethod : uint8
+{
+	/** Grade regular com ~Budget pontos */
+	Grid,
+	/** Budget pontos uniformes */
+	Random,
+	/** (1+1)-ES com passo adaptado pela regra de 1/5, a partir de Start */
+	Evolution
+};
+
+struct FParameterSearchResult
+{
+	TArray<double> Values;
+	double Cost = TNumericLimits<double>::Max();
+	int32 NumEvaluations = 0;
+};
+
+/**
+ * Minimizador de caixa-preta para poucas dimensões
+ * Cada avaliação do custo já é uma simulação paralela (caminhadas ou
+ * batalhas), então a busca em si é sequencial. O custo deve usar a mesma
+ * seed em todos os candidatos (números aleatórios comuns): assim ele é
+ * determinístico e dois candidatos diferem só pelos parâmetros, não pelo
+ * ruído da amostragem.
+ */
+class J_API FParameterSearch
+{
+public:
+	using FCostFunction = TFunctionRef<double(TConstArrayView<double> Values)>;
+
+	static FParameterSearchResult Minimize(TConstArrayView<FSearchParameter> Parameters, FCostFunction Cost,
+		EParameterSearchMethod Method, int32 Budget, int32 Seed);
+
+	/** "Grid" / "Random" / "Evolution" (sem diferenciar maiúsculas) */
+	static bool ParseMethod(const FString& Name, EParameterSearchMethod& OutMethod);
+};
@@ -38,6 +38,78 @@ enum class EElementAffinity : uint8
 	Drain    UMETA(DisplayName = "Drain")      // Absorve como HP
 };
 
+/**
+ * Raça do demônio (usada em fusão e no compêndio)
+ */
+UENUM(BlueprintType)
+enum class EDemonRace : uint8
+{
+	Deity       UMETA(DisplayName = "Deity"),
+	Megami      UMETA(DisplayName = "Megami"),
+	Kishin      UMETA(DisplayName = "Kishin"),
+	Holy        UMETA(DisplayName = "Holy"),
+	Beast       UMETA(DisplayName = "Beast"),
+	Fairy       UMETA(DisplayName = "Fairy"),
+	Divine      UMETA(DisplayName = "Divine"),
+	Fallen      UMETA(DisplayName = "Fallen"),
+	Snake       UMETA(DisplayName = "Snake"),
+	Jirae       UMETA(DisplayName = "Jirae"),
+	Brute       UMETA(DisplayName = "Brute"),
+	Femme       UMETA(DisplayName = "Femme"),
+	Night       UMETA(DisplayName = "Night"),
+	Tyrant      UMETA(DisplayName = "Tyrant"),
+	Haunt       UMETA(DisplayName = "Haunt"),
+	Foul        UMETA(DisplayName = "Foul"),
+	Element     UMETA(DisplayName = "Element"),
+	MAX         UMETA(Hidden)
+};
+
+/**
+ * Buffs, debuffs e ailments (estilo -kaja/-nda de SMT)
+ */
+UENUM(BlueprintType)
+enum class EStatusEffect : uint8
+{
+	None        UMETA(DisplayName = "None"),
+	Tarukaja    UMETA(DisplayName = "Tarukaja"),    // Ataque aumentado
+	Rakukaja    UMETA(DisplayName = "Rakukaja"),    // Defesa aumentada
+	Sukukaja    UMETA(DisplayName = "Sukukaja"),    // Acerto/Evasão aumentados
+	Tarunda     UMETA(DisplayName = "Tarunda"),     // Ataque reduzido
+	Rakunda     UMETA(DisplayName = "Rakunda"),     // Defesa reduzida
+	Sukunda     UMETA(DisplayName = "Sukunda"),     // Acerto/Evasão reduzidos
+	Guard       UMETA(DisplayName = "Guard"),       // Defendendo (até o próximo turno)
+	Poison      UMETA(DisplayName = "Poison"),      // Perde HP a cada turno
+	Paralysis   UMETA(DisplayName = "Paralysis"),   // Não pode agir
+	Sleep       UMETA(DisplayName = "Sleep"),       // Não pode agir, recebe mais dano
+	MAX         UMETA(Hidden)
+};
+
+/**
+ * O que uma skill (ou item) faz com cada alvo
+ */
+UENUM(BlueprintType)
+enum class ESkillEffectType : uint8
+{
+	Damage      UMETA(DisplayName = "Damage"),       // Dano (+ efeito de status opcional)
+	HealHP      UMETA(DisplayName = "Heal HP"),      // Cura BasePower de HP
+	HealMP      UMETA(DisplayName = "Heal MP"),      // Recupera BasePower de MP
+	Revive      UMETA(DisplayName = "Revive"),       // Revive com BasePower% do HP
+	CureStatus  UMETA(DisplayName = "Cure Status"),  // Remove StatusEffect
+	StatusOnly  UMETA(DisplayName = "Status Only")   // Só aplica StatusEffect (buffs/debuffs)
+};
+
+/**
+ * Fórmula de dano base usada pelo combate (ver Combat/DamageFormulas.h)
+ */
+UENUM(BlueprintType)
+enum class EDamageFormula : uint8
+{
+	Classic     UMETA(DisplayName = "Classic"),   // (Poder + Ataque) - Defesa/2
+	SMT1        UMETA(DisplayName = "SMT I"),     // Subtrativa, ataque pesa em dobro
+	SMT3        UMETA(DisplayName = "SMT III"),   // Multiplicativa, defesa divide
+	Persona     UMETA(DisplayName = "Persona")    // Raiz de Poder * Ataque / Defesa
+};
+
 /**
  * Estrutura para estatísticas base de um personagem/demônio
  */
@@ -77,6 +149,31 @@ struct FCharacterStats
 	int32 Luck = 10;        // Críticos/Drops
 };
 
+/**
+ * Crescimento de stats por nível
+ * Taxas em décimos de ponto por nível (5 = +1 a cada 2 níveis).
+ */
+USTRUCT(BlueprintType)
+struct FStatGrowth
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Growth", meta = (ClampMin = "0"))
+	int32 Strength = 5;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Growth", meta = (ClampMin = "0"))
+	int32 Magic = 5;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Growth", meta = (ClampMin = "0"))
+	int32 Vitality = 5;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Growth", meta = (ClampMin = "0"))
+	int32 Agility = 5;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Growth", meta = (ClampMin = "0"))
+	int32 Luck = 5;
+};
+
 /**
  * Estrutura para definir afinidades elementais
  */
@@ -140,6 +237,9 @@ struct FSkillData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
 	FText Description;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
+	ESkillEffectType EffectType = ESkillEffectType::Damage;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
 	ERPGElement Element = ERPGElement::Physical;
 
@@ -154,6 +254,62 @@ struct FSkillData
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
 	float Accuracy = 95.0f;  // Porcentagem de acerto
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
+	bool bTargetsAllies = false;  // True = buffs/curas no próprio lado
+
+	/** Efeito aplicado nos alvos (None = nenhum) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill|Status")
+	EStatusEffect StatusEffect = EStatusEffect::None;
+
+	/** Duração do efeito em turnos */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill|Status")
+	int32 StatusDuration = 3;
+
+	/** Chance de aplicar o efeito (0-100) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill|Status")
+	float StatusChance = 100.0f;
+};
+
+/**
+ * Inimigo sorteável de um encontro, com peso
+ */
+USTRUCT(BlueprintType)
+struct FEncounterEnemyEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	TSubclassOf<class AEnemyBase> EnemyClass;
+
+	/** Peso no sorteio (maior = mais comum) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	float Weight = 1.0f;
+
+	/** Máximo deste inimigo no grupo (0 = sem limite) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	int32 MaxCount = 0;
+};
+
+/**
+ * Formação de batalha: posições dos inimigos relativas à origem da arena
+ * Os primeiros slots são preenchidos primeiro (frente/centro).
+ */
+USTRUCT(BlueprintType)
+struct FEncounterFormation
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	FName FormationID;
+
+	/** Offsets locais de cada slot (X = profundidade, Y = lateral) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	TArray<FVector2D> Slots;
+
+	/** Peso no sorteio (maior = mais comum) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	float Weight = 1.0f;
 };
 
 /**
@@ -167,10 +323,18 @@ struct FEncounterData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
 	FName EncounterID;
 
-	/** Classes de inimigos que podem aparecer */
+	/** Classes de inimigos que podem aparecer (peso igual; ignorado se EnemyEntries tiver itens) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
 	TArray<TSubclassOf<class AEnemyBase>> PossibleEnemies;
 
+	/** Inimigos com peso e limite por grupo */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	TArray<FEncounterEnemyEntry> EnemyEntries;
+
+	/** Formações possíveis (vazio = inimigos em linha) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	TArray<FEncounterFormation> Formations;
+
 	/** Número mínimo de inimigos */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
 	int32 MinEnemies = 1;
@@ -182,4 +346,83 @@ struct FEncounterData
 	/** Peso do encontro (maior = mais comum) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
 	float Weight = 1.0f;
+
+	/** Número de tipos de inimigo sorteáveis */
+	int32 GetNumEnemyTypes() const
+	{
+		return EnemyEntries.Num() > 0 ? EnemyEntries.Num() : PossibleEnemies.Num();
+	}
+
+	/** Classe do tipo de inimigo (índice de FEncounterSpawnDescriptor::EnemyIndices) */
+	TSubclassOf<class AEnemyBase> GetEnemyClass(int32 EnemyIndex) const
+	{
+		return EnemyEntries.Num() > 0 ? EnemyEntries[EnemyIndex].EnemyClass : PossibleEnemies[EnemyIndex];
+	}
+};
+
+/**
+ * Composição concreta de um encontro, sorteada uma vez pelo URandomEncounterManager
+ * Guarda só índices no FEncounterData de origem: inimigo e slot de cada spawn.
+ */
+USTRUCT(BlueprintType)
+struct FEncounterSpawnDescriptor
+{
+	GENERATED_BODY()
+
+	/** Formação usada (INDEX_NONE = em linha) */
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	int32 FormationIndex = INDEX_NONE;
+
+	/** Tipo de inimigo de cada spawn (ver FEncounterData::GetEnemyClass) */
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	TArray<uint8> EnemyIndices;
+
+	/** Slot da formação de cada spawn */
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	TArray<uint8> SlotIndices;
+
+	/** Quantidade de cada tipo de inimigo */
+	UPROPERTY(BlueprintReadOnly, Category = "Encounter")
+	TArray<uint8> EnemyCounts;
+
+	int32 Num() const { return EnemyIndices.Num(); }
+
+	void Reset()
+	{
+		FormationIndex = INDEX_NONE;
+		EnemyIndices.Reset();
+		SlotIndices.Reset();
+		EnemyCounts.Reset();
+	}
+};
+
+/**
+ * Snapshot de HP/MP de um participante, usado para atualizar a UI em lote
+ */
+USTRUCT(BlueprintType)
+struct FParticipantStatsSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	AActor* Participant = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 CurrentHP = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 MaxHP = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 CurrentMP = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 MaxMP = 0;
 };
+
+/**
+ * Notificação nativa de mudança de stats (HP/MP)
+ * Não passa por reflexão: quem escuta apenas marca o participante como "sujo"
+ * e a UI consolida as atualizações uma vez por frame.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRPGStatsChanged, AActor* /*Participant*/);
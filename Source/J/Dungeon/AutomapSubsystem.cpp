@@ -0,0 +1,191 @@
+// AutomapSubsystem.cpp
+
+#include "AutomapSubsystem.h"
+#include "DungeonFloorAsset.h"
+#include "DungeonStreamingSubsystem.h"
+#include "Characters/FirstPersonRPGCharacter.h"
+#include "Engine/Texture2D.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** 1: nome do andar; 2: caminho do andar */
+	constexpr uint32 AutomapSaveVersion = 2;
+
+	/** Cor de uma célula no minimapa */
+	FColor GetCellColor(const FDungeonGrid& Grid, const FExplorationMap& Map, FIntPoint Cell)
+	{
+		if (!Map.IsSeen(Cell))
+		{
+			return FColor::Transparent;
+		}
+
+		switch (Grid.GetType(Cell))
+		{
+		case EDungeonCellType::Wall:       return FColor(90, 90, 110);
+		case EDungeonCellType::Door:       return FColor(200, 160, 60);
+		case EDungeonCellType::StairsUp:   return FColor(80, 200, 255);
+		case EDungeonCellType::StairsDown: return FColor(40, 120, 255);
+		default: break;
+		}
+
+		if (Grid.HasFlag(Cell, FDungeonGrid::DamageFlag))
+		{
+			return FColor(200, 40, 40);
+		}
+		return Map.IsVisited(Cell) ? FColor(220, 220, 220) : FColor(120, 120, 120);
+	}
+}
+
+void UAutomapSubsystem::Deinitialize()
+{
+	if (AFirstPersonRPGCharacter* Character = TrackedCharacter.Get())
+	{
+		Character->OnGridCellEntered.RemoveAll(this);
+	}
+
+	ActiveMap = nullptr;
+	Super::Deinitialize();
+}
+
+void UAutomapSubsystem::SetTrackedCharacter(AFirstPersonRPGCharacter* Character)
+{
+	if (AFirstPersonRPGCharacter* Previous = TrackedCharacter.Get())
+	{
+		Previous->OnGridCellEntered.RemoveAll(this);
+	}
+
+	TrackedCharacter = Character;
+
+	if (Character)
+	{
+		Character->OnGridCellEntered.AddUObject(this, &UAutomapSubsystem::HandleGridCellEntered);
+		HandleGridCellEntered(Character, Character->GetCurrentGridCell());
+	}
+}
+
+const FExplorationMap* UAutomapSubsystem::FindExploration(const UDungeonFloorAsset* Floor) const
+{
+	return Floor ? Floors.Find(FSoftObjectPath(Floor)) : nullptr;
+}
+
+void UAutomapSubsystem::HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell)
+{
+	const UDungeonStreamingSubsystem* Streaming = Character->GetWorld()->GetSubsystem<UDungeonStreamingSubsystem>();
+	const UDungeonFloorAsset* Floor = Streaming ? Streaming->GetFloor() : nullptr;
+	if (!Floor || Floor->Grid.Width <= 0)
+	{
+		return;
+	}
+
+	if (Floor != ActiveFloor.Get())
+	{
+		ActivateFloor(Floor);
+	}
+
+	ActiveMap->MarkVisited(Cell);
+	ActiveMap->RevealLineOfSight(Floor->Grid, Cell, RevealRadius);
+	FlushMinimapTexture();
+}
+
+void UAutomapSubsystem::ActivateFloor(const UDungeonFloorAsset* Floor)
+{
+	const FDungeonGrid& Grid = Floor->Grid;
+
+	ActiveFloor = Floor;
+	ActiveMap = &Floors.FindOrAdd(FSoftObjectPath(Floor));
+	if (ActiveMap->Width != Grid.Width || ActiveMap->Height != Grid.Height)
+	{
+		ActiveMap->Init(Grid.Width, Grid.Height);
+	}
+
+	// Textura nova para o andar: a primeira atualização desenha tudo que já foi explorado
+	MinimapTexture = UTexture2D::CreateTransient(Grid.Width, Grid.Height, PF_B8G8R8A8);
+	MinimapTexture->Filter = TF_Nearest;
+	MinimapTexture->SRGB = true;
+	MinimapTexture->UpdateResource();
+	ActiveMap->MarkAllDirty();
+}
+
+void UAutomapSubsystem::FlushMinimapTexture()
+{
+	const UDungeonFloorAsset* Floor = ActiveFloor.Get();
+	FIntRect Rect;
+	if (!Floor || !MinimapTexture || !ActiveMap->ConsumeDirtyRect(Rect))
+	{
+		return;
+	}
+
+	const int32 RectWidth = Rect.Width();
+	const int32 RectHeight = Rect.Height();
+
+	// O render thread libera o buffer depois de copiar
+	FColor* Pixels = new FColor[RectWidth * RectHeight];
+	for (int32 Y = 0; Y < RectHeight; Y++)
+	{
+		for (int32 X = 0; X < RectWidth; X++)
+		{
+			Pixels[Y * RectWidth + X] = GetCellColor(Floor->Grid, *ActiveMap, Rect.Min + FIntPoint(X, Y));
+		}
+	}
+
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(Rect.Min.X, Rect.Min.Y, 0, 0, RectWidth, RectHeight);
+	MinimapTexture->UpdateTextureRegions(0, 1, Region, RectWidth * sizeof(FColor), sizeof(FColor), (uint8*)Pixels,
+		[](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+		{
+			delete[] (FColor*)SrcData;
+			delete Regions;
+		});
+}
+
+// ==================== SAVE ====================
+
+void UAutomapSubsystem::SaveToBytes(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Version = AutomapSaveVersion;
+	int32 NumFloors = Floors.Num();
+	Writer << Version;
+	Writer << NumFloors;
+
+	for (const TPair<FSoftObjectPath, FExplorationMap>& Pair : Floors)
+	{
+		FString FloorPath = Pair.Key.ToString();
+		Writer << FloorPath;
+		const_cast<FExplorationMap&>(Pair.Value).Serialize(Writer);
+	}
+}
+
+bool UAutomapSubsystem::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+	FMemoryReader Reader(Bytes);
+
+	uint32 Version = 0;
+	int32 NumFloors = 0;
+	Reader << Version;
+	Reader << NumFloors;
+
+	// Saves da versão 1 guardavam só o nome, que não identifica o andar com segurança
+	if (Reader.IsError() || Version != AutomapSaveVersion || NumFloors < 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Automap: Save inválido (versão %u)"), Version);
+		return false;
+	}
+
+	Floors.Reset();
+	ActiveMap = nullptr;
+	ActiveFloor = nullptr;
+
+	for (int32 i = 0; i < NumFloors && !Reader.IsError(); i++)
+	{
+		FString FloorPath;
+		Reader << FloorPath;
+		Floors.Add(FSoftObjectPath(FloorPath)).Serialize(Reader);
+	}
+
+	// O andar atual é reativado no próximo passo
+	return !Reader.IsError();
+}
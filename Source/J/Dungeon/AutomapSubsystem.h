@@ -0,0 +1,77 @@
+// AutomapSubsystem.h
+// Automapa: exploração por andar e textura do minimapa
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/SoftObjectPath.h"
+#include "ExplorationMap.h"
+#include "AutomapSubsystem.generated.h"
+
+class UTexture2D;
+class UDungeonFloorAsset;
+class AFirstPersonRPGCharacter;
+
+/**
+ * Automapa
+ * Guarda a exploração de cada andar visitado (persistente entre mapas) e
+ * atualiza a cada passo concluído: marca a célula, revela a linha de visão e
+ * reenvia à textura do minimapa apenas o retângulo que mudou.
+ */
+UCLASS()
+class J_API UAutomapSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Raio (em células) revelado a cada passo */
+	UPROPERTY(BlueprintReadWrite, Category = "Automap")
+	int32 RevealRadius = 4;
+
+	/** Passa a seguir os passos deste personagem */
+	void SetTrackedCharacter(AFirstPersonRPGCharacter* Character);
+
+	/** Textura do andar atual (1 pixel por célula) */
+	UFUNCTION(BlueprintPure, Category = "Automap")
+	UTexture2D* GetMinimapTexture() const { return MinimapTexture; }
+
+	UFUNCTION(BlueprintPure, Category = "Automap")
+	bool IsCellVisited(FIntPoint Cell) const { return ActiveMap && ActiveMap->IsVisited(Cell); }
+
+	UFUNCTION(BlueprintPure, Category = "Automap")
+	bool IsCellSeen(FIntPoint Cell) const { return ActiveMap && ActiveMap->IsSeen(Cell); }
+
+	/** Exploração de um andar (nullptr se nunca visitado) */
+	const FExplorationMap* FindExploration(const UDungeonFloorAsset* Floor) const;
+
+	// ==================== SAVE ====================
+
+	/** Grava a exploração de todos os andares (bitsets em run-length) */
+	void SaveToBytes(TArray<uint8>& OutBytes) const;
+
+	bool LoadFromBytes(const TArray<uint8>& Bytes);
+
+private:
+	void HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell);
+
+	/** Troca o andar ativo (cria a exploração e a textura do andar) */
+	void ActivateFloor(const UDungeonFloorAsset* Floor);
+
+	/** Envia o retângulo sujo para a textura */
+	void FlushMinimapTexture();
+
+	/** Exploração por andar (chave: caminho completo do UDungeonFloorAsset; nomes podem se repetir entre pastas) */
+	TMap<FSoftObjectPath, FExplorationMap> Floors;
+
+	/** Andar ativo (aponta para Floors; só muda em ActivateFloor) */
+	FExplorationMap* ActiveMap = nullptr;
+
+	TWeakObjectPtr<const UDungeonFloorAsset> ActiveFloor;
+	TWeakObjectPtr<AFirstPersonRPGCharacter> TrackedCharacter;
+
+	UPROPERTY(Transient)
+	UTexture2D* MinimapTexture = nullptr;
+};
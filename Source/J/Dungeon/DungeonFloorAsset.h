@@ -0,0 +1,66 @@
+// DungeonFloorAsset.h
+// Andar de dungeon dividido em chunks de grid
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "DungeonTypes.h"
+#include "DungeonFloorAsset.generated.h"
+
+/**
+ * Andar de dungeon
+ * O andar é dividido em chunks quadrados de ChunkSizeCells células, cada um
+ * com seu próprio level (instanciado na origem do chunk). Os levels ficam em
+ * um array denso linha a linha, então achar o chunk de uma célula é O(1).
+ */
+UCLASS(BlueprintType)
+class J_API UDungeonFloorAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Tamanho da célula (deve bater com AFirstPersonRPGCharacter::GridCellSize) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon")
+	float CellSize = 200.0f;
+
+	/** Altura do andar no mundo */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon")
+	float FloorHeight = 0.0f;
+
+	/** Lado de cada chunk, em células */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon|Streaming", meta = (ClampMin = "1"))
+	int32 ChunkSizeCells = 16;
+
+	/** Chunks a até esta distância (em células) do jogador ficam carregados */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon|Streaming", meta = (ClampMin = "0"))
+	int32 StreamingRadiusCells = 12;
+
+	/** Distância extra antes de descarregar (evita carregar/descarregar na borda) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon|Streaming", meta = (ClampMin = "0"))
+	int32 UnloadMarginCells = 4;
+
+	/** Layout do andar (paredes, portas, escadas, zonas escuras...) usado por automapa, interação e IA */
+	UPROPERTY(EditAnywhere, Category = "Dungeon")
+	FDungeonGrid Grid;
+
+	/** Número de chunks em X e Y */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon|Streaming")
+	FIntPoint NumChunks = FIntPoint(1, 1);
+
+	/** Level de cada chunk (linha a linha, NumChunks.X * NumChunks.Y; vazio = sem geometria) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dungeon|Streaming")
+	TArray<TSoftObjectPtr<UWorld>> ChunkLevels;
+
+	/** Level do chunk, ou nullptr fora do andar */
+	const TSoftObjectPtr<UWorld>* GetChunkLevel(FIntPoint Chunk) const
+	{
+		if (Chunk.X < 0 || Chunk.Y < 0 || Chunk.X >= NumChunks.X || Chunk.Y >= NumChunks.Y)
+		{
+			return nullptr;
+		}
+
+		const int32 Index = Chunk.Y * NumChunks.X + Chunk.X;
+		return ChunkLevels.IsValidIndex(Index) && !ChunkLevels[Index].IsNull() ? &ChunkLevels[Index] : nullptr;
+	}
+};
@@ -0,0 +1,211 @@
+// DungeonGenerator.cpp
+
+#include "DungeonGenerator.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	FORCEINLINE FIntPoint RoomCenter(const FIntRect& Room)
+	{
+		return FIntPoint((Room.Min.X + Room.Max.X) / 2, (Room.Min.Y + Room.Max.Y) / 2);
+	}
+
+	/** Salas (Min inclusivo, Max exclusivo) separadas por pelo menos uma parede? */
+	FORCEINLINE bool RoomsOverlap(const FIntRect& A, const FIntRect& B)
+	{
+		return A.Min.X - 1 < B.Max.X && B.Min.X - 1 < A.Max.X && A.Min.Y - 1 < B.Max.Y && B.Min.Y - 1 < A.Max.Y;
+	}
+
+	void CarveRoom(FDungeonGrid& Grid, const FIntRect& Room, uint8 Region)
+	{
+		for (int32 Y = Room.Min.Y; Y < Room.Max.Y; Y++)
+		{
+			const int32 RowStart = Y * Grid.Width;
+			FMemory::Memset(&Grid.Cells[RowStart + Room.Min.X], (uint8)EDungeonCellType::Floor, Room.Width());
+			FMemory::Memset(&Grid.Regions[RowStart + Room.Min.X], Region, Room.Width());
+		}
+	}
+
+	/** Abre uma célula de corredor sem sobrescrever salas */
+	FORCEINLINE void CarveCorridorCell(FDungeonGrid& Grid, int32 X, int32 Y, uint8 Region)
+	{
+		const int32 Index = Y * Grid.Width + X;
+		if ((Grid.Cells[Index] & FDungeonGrid::TypeMask) == (uint8)EDungeonCellType::Wall)
+		{
+			Grid.Cells[Index] = (uint8)EDungeonCellType::Floor;
+			Grid.Regions[Index] = Region;
+		}
+	}
+
+	/** Corredor em L entre dois pontos */
+	void CarveCorridor(FDungeonGrid& Grid, FIntPoint From, FIntPoint To, bool bHorizontalFirst, uint8 Region)
+	{
+		const FIntPoint Corner = bHorizontalFirst ? FIntPoint(To.X, From.Y) : FIntPoint(From.X, To.Y);
+
+		for (int32 X = FMath::Min(From.X, Corner.X); X <= FMath::Max(From.X, Corner.X); X++)
+		{
+			CarveCorridorCell(Grid, X, From.Y, Region);
+		}
+		for (int32 Y = FMath::Min(From.Y, Corner.Y); Y <= FMath::Max(From.Y, Corner.Y); Y++)
+		{
+			CarveCorridorCell(Grid, From.X, Y, Region);
+		}
+		for (int32 X = FMath::Min(Corner.X, To.X); X <= FMath::Max(Corner.X, To.X); X++)
+		{
+			CarveCorridorCell(Grid, X, To.Y, Region);
+		}
+		for (int32 Y = FMath::Min(Corner.Y, To.Y); Y <= FMath::Max(Corner.Y, To.Y); Y++)
+		{
+			CarveCorridorCell(Grid, To.X, Y, Region);
+		}
+	}
+
+	/** Célula de corredor na borda da sala, entre duas paredes: vira porta */
+	FORCEINLINE void TryPlaceDoor(FDungeonGrid& Grid, FIntPoint Cell, FIntPoint Side)
+	{
+		if (Grid.GetType(Cell) == EDungeonCellType::Floor
+			&& Grid.GetType(Cell + Side) == EDungeonCellType::Wall
+			&& Grid.GetType(Cell - Side) == EDungeonCellType::Wall)
+		{
+			Grid.SetType(Cell, EDungeonCellType::Door);
+		}
+	}
+
+	void PlaceDoors(FDungeonGrid& Grid, const FIntRect& Room)
+	{
+		for (int32 X = Room.Min.X; X < Room.Max.X; X++)
+		{
+			TryPlaceDoor(Grid, FIntPoint(X, Room.Min.Y - 1), FIntPoint(1, 0));
+			TryPlaceDoor(Grid, FIntPoint(X, Room.Max.Y), FIntPoint(1, 0));
+		}
+		for (int32 Y = Room.Min.Y; Y < Room.Max.Y; Y++)
+		{
+			TryPlaceDoor(Grid, FIntPoint(Room.Min.X - 1, Y), FIntPoint(0, 1));
+			TryPlaceDoor(Grid, FIntPoint(Room.Max.X, Y), FIntPoint(0, 1));
+		}
+	}
+
+	void SetFlagInRect(FDungeonGrid& Grid, const FIntRect& Rect, uint8 Flag)
+	{
+		for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; Y++)
+		{
+			for (int32 X = Rect.Min.X; X < Rect.Max.X; X++)
+			{
+				Grid.Cells[Y * Grid.Width + X] |= Flag;
+			}
+		}
+	}
+}
+
+void FDungeonGenerator::Generate(const FDungeonGenParams& Params, int32 Seed, FDungeonFloorLayout& OutLayout)
+{
+	FRandomStream Random(Seed);
+
+	const int32 MinRoom = FMath::Max(2, Params.MinRoomSize);
+	const int32 MaxRoom = FMath::Max(MinRoom, Params.MaxRoomSize);
+	const int32 Width = FMath::Max(Params.Width, MaxRoom + 2);
+	const int32 Height = FMath::Max(Params.Height, MaxRoom + 2);
+
+	FDungeonGrid& Grid = OutLayout.Grid;
+	Grid.Init(Width, Height);
+
+	const uint8 CorridorRegion = Params.CorridorEncounterTable != INDEX_NONE ? (uint8)(Params.CorridorEncounterTable + 1) : 0;
+	const int32 NumTables = FMath::Min(Params.NumEncounterTables, 255);
+
+	// 1) Salas: tentativas aleatórias, descartando as que encostam em outras
+	TArray<FIntRect>& Rooms = OutLayout.Rooms;
+	Rooms.Reset(Params.MaxRooms);
+
+	const int32 MaxAttempts = Params.MaxRooms * 8;
+	for (int32 Attempt = 0; Attempt < MaxAttempts && Rooms.Num() < Params.MaxRooms; Attempt++)
+	{
+		const int32 RoomWidth = Random.RandRange(MinRoom, MaxRoom);
+		const int32 RoomHeight = Random.RandRange(MinRoom, MaxRoom);
+		const FIntPoint Min(Random.RandRange(1, Width - RoomWidth - 1), Random.RandRange(1, Height - RoomHeight - 1));
+		const FIntRect Room(Min, Min + FIntPoint(RoomWidth, RoomHeight));
+
+		if (!Rooms.ContainsByPredicate([&Room](const FIntRect& Other) { return RoomsOverlap(Room, Other); }))
+		{
+			const uint8 Region = NumTables > 0 ? (uint8)Random.RandRange(1, NumTables) : 0;
+			CarveRoom(Grid, Room, Region);
+			Rooms.Add(Room);
+		}
+	}
+
+	if (Rooms.Num() == 0)
+	{
+		return;
+	}
+
+	// 2) Corredores: cada sala liga à anterior (conectividade garantida) e algumas ganham atalhos
+	for (int32 i = 1; i < Rooms.Num(); i++)
+	{
+		CarveCorridor(Grid, RoomCenter(Rooms[i - 1]), RoomCenter(Rooms[i]), Random.RandRange(0, 1) == 0, CorridorRegion);
+
+		if (Random.RandRange(0, 999) < Params.ExtraCorridorPermille)
+		{
+			const int32 Other = Random.RandRange(0, Rooms.Num() - 1);
+			CarveCorridor(Grid, RoomCenter(Rooms[i]), RoomCenter(Rooms[Other]), Random.RandRange(0, 1) == 0, CorridorRegion);
+		}
+	}
+
+	// 3) Portas onde os corredores entram nas salas
+	for (const FIntRect& Room : Rooms)
+	{
+		PlaceDoors(Grid, Room);
+	}
+
+	// 4) Escadas: subida na primeira sala, descida na sala mais distante dela
+	OutLayout.StairsUp = RoomCenter(Rooms[0]);
+	int32 FarthestRoom = 0;
+	int32 FarthestDistance = -1;
+	for (int32 i = 1; i < Rooms.Num(); i++)
+	{
+		const FIntPoint Delta = RoomCenter(Rooms[i]) - OutLayout.StairsUp;
+		const int32 Distance = FMath::Abs(Delta.X) + FMath::Abs(Delta.Y);
+		if (Distance > FarthestDistance)
+		{
+			FarthestDistance = Distance;
+			FarthestRoom = i;
+		}
+	}
+	OutLayout.StairsDown = RoomCenter(Rooms[FarthestRoom]);
+	Grid.SetType(OutLayout.StairsUp, EDungeonCellType::StairsUp);
+	if (FarthestRoom != 0)
+	{
+		Grid.SetType(OutLayout.StairsDown, EDungeonCellType::StairsDown);
+	}
+
+	// 5) Zonas escuras e pisos de dano (nunca nas salas das escadas)
+	for (int32 i = 1; i < Rooms.Num(); i++)
+	{
+		if (i == FarthestRoom)
+		{
+			continue;
+		}
+
+		const FIntRect& Room = Rooms[i];
+		if (Random.RandRange(0, 999) < Params.DarkRoomPermille)
+		{
+			SetFlagInRect(Grid, Room, FDungeonGrid::DarkFlag);
+		}
+
+		if (Random.RandRange(0, 999) < Params.DamageRoomPermille)
+		{
+			const FIntPoint PatchSize(Random.RandRange(1, Room.Width()), Random.RandRange(1, Room.Height()));
+			const FIntPoint PatchMin(Random.RandRange(Room.Min.X, Room.Max.X - PatchSize.X), Random.RandRange(Room.Min.Y, Room.Max.Y - PatchSize.Y));
+			SetFlagInRect(Grid, FIntRect(PatchMin, PatchMin + PatchSize), FDungeonGrid::DamageFlag);
+		}
+	}
+}
+
+void FDungeonGenerator::GenerateFloors(const FDungeonGenParams& Params, int32 BaseSeed, int32 NumFloors, TArray<FDungeonFloorLayout>& OutFloors)
+{
+	OutFloors.SetNum(NumFloors);
+
+	// Andares independentes: cada um escreve só no seu layout, com seu próprio RNG
+	ParallelFor(NumFloors, [&Params, BaseSeed, &OutFloors](int32 FloorIndex)
+	{
+		Generate(Params, GetFloorSeed(BaseSeed, FloorIndex), OutFloors[FloorIndex]);
+	});
+}
@@ -0,0 +1,77 @@
+// DungeonGenerator.h
+// Gerador procedural de andares (headless, determinístico por seed)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "DungeonTypes.h"
+
+/**
+ * Parâmetros de geração de um andar
+ */
+struct FDungeonGenParams
+{
+	int32 Width = 64;
+	int32 Height = 64;
+
+	/** Salas */
+	int32 MaxRooms = 24;
+	int32 MinRoomSize = 4;
+	int32 MaxRoomSize = 10;
+
+	/** Corredores extras além da árvore que liga todas as salas (por mil, por sala) */
+	int32 ExtraCorridorPermille = 150;
+
+	/** Chance de uma sala ser escura / ter piso de dano (por mil) */
+	int32 DarkRoomPermille = 100;
+	int32 DamageRoomPermille = 80;
+
+	/** Tabelas de encontro sorteadas para as salas (região = índice + 1) */
+	int32 NumEncounterTables = 0;
+
+	/** Tabela dos corredores (INDEX_NONE = sem encontros nos corredores) */
+	int32 CorridorEncounterTable = INDEX_NONE;
+};
+
+/**
+ * Andar gerado
+ */
+struct FDungeonFloorLayout
+{
+	FDungeonGrid Grid;
+
+	/** Salas na ordem de geração */
+	TArray<FIntRect> Rooms;
+
+	FIntPoint StairsUp = FIntPoint::ZeroValue;
+	FIntPoint StairsDown = FIntPoint::ZeroValue;
+
+	/** Tabela de encontros da célula (regiões apontam para Tables[Região - 1]) */
+	const FDungeonEncounterTable* GetEncounterTable(FIntPoint Cell, TConstArrayView<FDungeonEncounterTable> Tables) const
+	{
+		const int32 Region = Grid.GetRegion(Cell);
+		return Region > 0 && Tables.IsValidIndex(Region - 1) ? &Tables[Region - 1] : nullptr;
+	}
+};
+
+/**
+ * Gerador de andares
+ * Sem UWorld/atores: a saída é o grid compacto consumido pela exploração.
+ * Cada andar usa seu próprio FRandomStream, então a geração é determinística
+ * pela seed e vários andares podem ser gerados em paralelo.
+ */
+struct J_API FDungeonGenerator
+{
+	/** Gera um andar */
+	static void Generate(const FDungeonGenParams& Params, int32 Seed, FDungeonFloorLayout& OutLayout);
+
+	/** Gera NumFloors andares em paralelo (andar i usa GetFloorSeed(BaseSeed, i)) */
+	static void GenerateFloors(const FDungeonGenParams& Params, int32 BaseSeed, int32 NumFloors, TArray<FDungeonFloorLayout>& OutFloors);
+
+	/** Seed de um andar derivada da seed da dungeon */
+	static int32 GetFloorSeed(int32 BaseSeed, int32 FloorIndex)
+	{
+		return (int32)HashCombine(GetTypeHash(BaseSeed), GetTypeHash(FloorIndex));
+	}
+};
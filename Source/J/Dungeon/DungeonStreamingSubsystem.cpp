@@ -0,0 +1,146 @@
+// DungeonStreamingSubsystem.cpp
+
+#include "DungeonStreamingSubsystem.h"
+#include "DungeonFloorAsset.h"
+#include "Core/GridTypes.h"
+#include "Characters/FirstPersonRPGCharacter.h"
+#include "Engine/LevelStreamingDynamic.h"
+
+void UDungeonStreamingSubsystem::Deinitialize()
+{
+	if (AFirstPersonRPGCharacter* Character = TrackedCharacter.Get())
+	{
+		Character->OnGridCellEntered.RemoveAll(this);
+	}
+
+	UnloadAllChunks();
+	Super::Deinitialize();
+}
+
+void UDungeonStreamingSubsystem::SetFloor(UDungeonFloorAsset* InFloor)
+{
+	if (InFloor == Floor)
+	{
+		return;
+	}
+
+	UnloadAllChunks();
+	Floor = InFloor;
+	OnFloorChanged.Broadcast(Floor);
+
+	if (bHasPlayerCell)
+	{
+		UpdateStreaming(LastPlayerCell);
+	}
+}
+
+void UDungeonStreamingSubsystem::SetTrackedCharacter(AFirstPersonRPGCharacter* Character)
+{
+	if (AFirstPersonRPGCharacter* Previous = TrackedCharacter.Get())
+	{
+		Previous->OnGridCellEntered.RemoveAll(this);
+	}
+
+	TrackedCharacter = Character;
+
+	if (Character)
+	{
+		Character->OnGridCellEntered.AddUObject(this, &UDungeonStreamingSubsystem::HandleGridCellEntered);
+		UpdateStreaming(Character->GetCurrentGridCell());
+	}
+}
+
+void UDungeonStreamingSubsystem::HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell)
+{
+	UpdateStreaming(Cell);
+}
+
+void UDungeonStreamingSubsystem::UpdateStreaming(FIntPoint PlayerCell)
+{
+	LastPlayerCell = PlayerCell;
+	bHasPlayerCell = true;
+
+	if (!Floor)
+	{
+		return;
+	}
+
+	const int32 ChunkSize = FMath::Max(1, Floor->ChunkSizeCells);
+	const FIntPoint Radius(Floor->StreamingRadiusCells);
+	const FIntPoint KeepRadius(Floor->StreamingRadiusCells + Floor->UnloadMarginCells);
+
+	// Janelas em coordenadas de chunk (inclusivas)
+	const FIntRect LoadWindow(FGridMath::CellToChunk(PlayerCell - Radius, ChunkSize), FGridMath::CellToChunk(PlayerCell + Radius, ChunkSize));
+	const FIntRect KeepWindow(FGridMath::CellToChunk(PlayerCell - KeepRadius, ChunkSize), FGridMath::CellToChunk(PlayerCell + KeepRadius, ChunkSize));
+
+	// A maioria dos passos não muda nenhuma das janelas
+	if (bHasWindow && LoadWindow == LastLoadWindow && KeepWindow == LastKeepWindow)
+	{
+		return;
+	}
+
+	LastLoadWindow = LoadWindow;
+	LastKeepWindow = KeepWindow;
+	bHasWindow = true;
+
+	// Descarregar o que saiu da janela de permanência
+	for (auto It = LoadedChunks.CreateIterator(); It; ++It)
+	{
+		const FIntPoint Chunk = It.Key();
+		if (Chunk.X < KeepWindow.Min.X || Chunk.X > KeepWindow.Max.X || Chunk.Y < KeepWindow.Min.Y || Chunk.Y > KeepWindow.Max.Y)
+		{
+			if (ULevelStreamingDynamic* Level = It.Value())
+			{
+				Level->SetIsRequestingUnloadAndRemoval(true);
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	// Carregar o que entrou na janela de carga
+	for (int32 Y = LoadWindow.Min.Y; Y <= LoadWindow.Max.Y; Y++)
+	{
+		for (int32 X = LoadWindow.Min.X; X <= LoadWindow.Max.X; X++)
+		{
+			const FIntPoint Chunk(X, Y);
+			if (!LoadedChunks.Contains(Chunk) && Floor->GetChunkLevel(Chunk))
+			{
+				LoadChunk(Chunk);
+			}
+		}
+	}
+}
+
+void UDungeonStreamingSubsystem::LoadChunk(FIntPoint Chunk)
+{
+	const int32 ChunkSize = FMath::Max(1, Floor->ChunkSizeCells);
+	const FVector Origin = FGridMath::CellToWorld(Chunk * ChunkSize, Floor->CellSize, Floor->FloorHeight);
+
+	// Sem bloquear: o pacote é carregado pelo loader assíncrono e o level aparece quando pronto
+	bool bSuccess = false;
+	ULevelStreamingDynamic* Level = ULevelStreamingDynamic::LoadLevelInstanceBySoftObjectPtr(
+		GetWorld(), *Floor->GetChunkLevel(Chunk), Origin, FRotator::ZeroRotator, bSuccess);
+
+	if (!bSuccess || !Level)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DungeonStreaming: Falha ao carregar chunk (%d, %d)"), Chunk.X, Chunk.Y);
+		return;
+	}
+
+	Level->bShouldBlockOnLoad = false;
+	LoadedChunks.Add(Chunk, Level);
+}
+
+void UDungeonStreamingSubsystem::UnloadAllChunks()
+{
+	for (const TPair<FIntPoint, ULevelStreamingDynamic*>& Pair : LoadedChunks)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->SetIsRequestingUnloadAndRemoval(true);
+		}
+	}
+
+	LoadedChunks.Reset();
+	bHasWindow = false;
+}
@@ -0,0 +1,76 @@
+// DungeonStreamingSubsystem.h
+// Streaming de chunks da dungeon guiado pelos passos no grid
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DungeonStreamingSubsystem.generated.h"
+
+class UDungeonFloorAsset;
+class ULevelStreamingDynamic;
+class AFirstPersonRPGCharacter;
+
+/** Disparado quando o andar atual é trocado (nativo; o andar anterior já foi descarregado) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDungeonFloorChangedNative, UDungeonFloorAsset* /*NewFloor*/);
+
+/**
+ * Streaming de chunks do andar atual
+ * Atualizado apenas quando o jogador termina um passo no grid (sem polling de
+ * distância por frame). Os chunks próximos são instanciados como level
+ * instances carregadas de forma assíncrona; os que saem da janela (com uma
+ * margem) são descarregados, então a memória fica limitada pelo raio e não
+ * pelo tamanho da dungeon.
+ */
+UCLASS()
+class J_API UDungeonStreamingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Troca o andar atual (descarrega todos os chunks do andar anterior) */
+	UFUNCTION(BlueprintCallable, Category = "Dungeon")
+	void SetFloor(UDungeonFloorAsset* InFloor);
+
+	UFUNCTION(BlueprintPure, Category = "Dungeon")
+	UDungeonFloorAsset* GetFloor() const { return Floor; }
+
+	/** Sistemas que guardam dados do grid do andar (ex.: grupos de encontro) */
+	FOnDungeonFloorChangedNative OnFloorChanged;
+
+	/** Passa a seguir os passos deste personagem */
+	void SetTrackedCharacter(AFirstPersonRPGCharacter* Character);
+
+	/** Atualiza os chunks para o jogador na célula */
+	void UpdateStreaming(FIntPoint PlayerCell);
+
+	/** Número de chunks instanciados */
+	UFUNCTION(BlueprintPure, Category = "Dungeon")
+	int32 GetNumLoadedChunks() const { return LoadedChunks.Num(); }
+
+private:
+	void HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell);
+
+	void LoadChunk(FIntPoint Chunk);
+	void UnloadAllChunks();
+
+	UPROPERTY(Transient)
+	UDungeonFloorAsset* Floor = nullptr;
+
+	/** Level instances carregadas por coordenada de chunk */
+	UPROPERTY(Transient)
+	TMap<FIntPoint, ULevelStreamingDynamic*> LoadedChunks;
+
+	TWeakObjectPtr<AFirstPersonRPGCharacter> TrackedCharacter;
+
+	/** Última célula recebida (para reaplicar ao trocar de andar) */
+	FIntPoint LastPlayerCell = FIntPoint::ZeroValue;
+	bool bHasPlayerCell = false;
+
+	/** Janelas de carga/descarga da última atualização; passos dentro do mesmo chunk saem cedo */
+	FIntRect LastLoadWindow;
+	FIntRect LastKeepWindow;
+	bool bHasWindow = false;
+};
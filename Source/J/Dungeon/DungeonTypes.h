@@ -0,0 +1,102 @@
+// DungeonTypes.h
+// Formato compacto de grid dos andares de dungeon
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+#include "DungeonTypes.generated.h"
+
+/**
+ * Tipo de uma célula (4 bits baixos de FDungeonGrid::Cells)
+ */
+enum class EDungeonCellType : uint8
+{
+	Wall = 0,
+	Floor,
+	Door,
+	StairsUp,
+	StairsDown
+};
+
+/**
+ * Grid de um andar: um byte de tipo/flags e um byte de região por célula
+ * A célula (X, Y) é a mesma célula de FGridMath (alinhada ao GridCellSize).
+ */
+USTRUCT()
+struct FDungeonGrid
+{
+	GENERATED_BODY()
+
+	static constexpr uint8 TypeMask = 0x0F;
+	static constexpr uint8 DarkFlag = 0x10;    // zona escura (sem mapa/visão)
+	static constexpr uint8 DamageFlag = 0x20;  // piso que causa dano
+
+	UPROPERTY()
+	int32 Width = 0;
+
+	UPROPERTY()
+	int32 Height = 0;
+
+	/** Tipo + flags, linha a linha */
+	UPROPERTY()
+	TArray<uint8> Cells;
+
+	/** Região de encontro de cada célula (0 = nenhuma) */
+	UPROPERTY()
+	TArray<uint8> Regions;
+
+	void Init(int32 InWidth, int32 InHeight)
+	{
+		Width = InWidth;
+		Height = InHeight;
+		Cells.Init((uint8)EDungeonCellType::Wall, Width * Height);
+		Regions.Init(0, Width * Height);
+	}
+
+	FORCEINLINE bool IsInside(FIntPoint Cell) const
+	{
+		return Cell.X >= 0 && Cell.Y >= 0 && Cell.X < Width && Cell.Y < Height;
+	}
+
+	FORCEINLINE int32 ToIndex(FIntPoint Cell) const { return Cell.Y * Width + Cell.X; }
+
+	FORCEINLINE EDungeonCellType GetType(FIntPoint Cell) const
+	{
+		return IsInside(Cell) ? (EDungeonCellType)(Cells[ToIndex(Cell)] & TypeMask) : EDungeonCellType::Wall;
+	}
+
+	FORCEINLINE bool IsWalkable(FIntPoint Cell) const { return GetType(Cell) != EDungeonCellType::Wall; }
+
+	FORCEINLINE bool HasFlag(FIntPoint Cell, uint8 Flag) const
+	{
+		return IsInside(Cell) && (Cells[ToIndex(Cell)] & Flag) != 0;
+	}
+
+	FORCEINLINE uint8 GetRegion(FIntPoint Cell) const
+	{
+		return IsInside(Cell) ? Regions[ToIndex(Cell)] : 0;
+	}
+
+	/** Troca o tipo mantendo as flags */
+	FORCEINLINE void SetType(FIntPoint Cell, EDungeonCellType Type)
+	{
+		uint8& Value = Cells[ToIndex(Cell)];
+		Value = (Value & ~TypeMask) | (uint8)Type;
+	}
+};
+
+/**
+ * Tabela de encontros de uma região
+ */
+USTRUCT(BlueprintType)
+struct FDungeonEncounterTable
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dungeon")
+	FName TableID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dungeon")
+	TArray<FEncounterData> Encounters;
+};
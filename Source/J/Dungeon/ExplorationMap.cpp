@@ -0,0 +1,233 @@
+// ExplorationMap.cpp
+
+#include "ExplorationMap.h"
+
+namespace
+{
+	void WriteVarInt(FArchive& Ar, uint32 Value)
+	{
+		do
+		{
+			uint8 Byte = Value & 0x7F;
+			Value >>= 7;
+			if (Value)
+			{
+				Byte |= 0x80;
+			}
+			Ar << Byte;
+		}
+		while (Value);
+	}
+
+	uint32 ReadVarInt(FArchive& Ar)
+	{
+		uint32 Value = 0;
+		for (int32 Shift = 0; Shift < 35 && !Ar.IsError(); Shift += 7)
+		{
+			uint8 Byte = 0;
+			Ar << Byte;
+			Value |= (uint32)(Byte & 0x7F) << Shift;
+			if (!(Byte & 0x80))
+			{
+				break;
+			}
+		}
+		return Value;
+	}
+
+	/** Runs alternados começando por zeros: exploração é formada por áreas contíguas */
+	void SaveRuns(FArchive& Ar, const TBitArray<>& Bits)
+	{
+		bool bCurrent = false;
+		uint32 Run = 0;
+		for (int32 i = 0; i < Bits.Num(); i++)
+		{
+			if (Bits[i] != bCurrent)
+			{
+				WriteVarInt(Ar, Run);
+				bCurrent = !bCurrent;
+				Run = 0;
+			}
+			Run++;
+		}
+		WriteVarInt(Ar, Run);
+	}
+
+	void LoadRuns(FArchive& Ar, TBitArray<>& Bits)
+	{
+		const int32 Num = Bits.Num();
+		bool bCurrent = false;
+		int32 Index = 0;
+		while (Index < Num && !Ar.IsError())
+		{
+			const int32 Run = FMath::Min((int32)ReadVarInt(Ar), Num - Index);
+			if (bCurrent)
+			{
+				Bits.SetRange(Index, Run, true);
+			}
+			Index += Run;
+			bCurrent = !bCurrent;
+		}
+	}
+}
+
+void FExplorationMap::Init(int32 InWidth, int32 InHeight)
+{
+	Width = InWidth;
+	Height = InHeight;
+	Visited.Init(false, Width * Height);
+	Seen.Init(false, Width * Height);
+	bDirty = false;
+}
+
+void FExplorationMap::MarkVisited(FIntPoint Cell)
+{
+	if (!IsInside(Cell))
+	{
+		return;
+	}
+
+	const int32 Index = Cell.Y * Width + Cell.X;
+	if (!Visited[Index])
+	{
+		Visited[Index] = true;
+		Seen[Index] = true;
+		ExpandDirtyRect(Cell);
+	}
+}
+
+void FExplorationMap::MarkSeen(FIntPoint Cell)
+{
+	if (!IsInside(Cell))
+	{
+		return;
+	}
+
+	const int32 Index = Cell.Y * Width + Cell.X;
+	if (!Seen[Index])
+	{
+		Seen[Index] = true;
+		ExpandDirtyRect(Cell);
+	}
+}
+
+void FExplorationMap::RevealLineOfSight(const FDungeonGrid& Grid, FIntPoint Origin, int32 Radius)
+{
+	if (Grid.HasFlag(Origin, FDungeonGrid::DarkFlag))
+	{
+		return;
+	}
+
+	auto BlocksSight = [&Grid](FIntPoint Cell)
+	{
+		if (!Grid.IsInside(Cell))
+		{
+			return true;
+		}
+		const EDungeonCellType Type = Grid.GetType(Cell);
+		return Type == EDungeonCellType::Wall || Type == EDungeonCellType::Door;
+	};
+
+	// Um raio (Bresenham) para cada célula da borda do quadrado
+	auto CastRay = [this, &Grid, &BlocksSight, Origin](FIntPoint Target)
+	{
+		const FIntPoint Delta(FMath::Abs(Target.X - Origin.X), -FMath::Abs(Target.Y - Origin.Y));
+		const FIntPoint Step(Target.X > Origin.X ? 1 : -1, Target.Y > Origin.Y ? 1 : -1);
+		FIntPoint Cell = Origin;
+		int32 Error = Delta.X + Delta.Y;
+
+		while (Cell != Target)
+		{
+			const FIntPoint Previous = Cell;
+			const int32 Error2 = 2 * Error;
+			if (Error2 >= Delta.Y)
+			{
+				Error += Delta.Y;
+				Cell.X += Step.X;
+			}
+			if (Error2 <= Delta.X)
+			{
+				Error += Delta.X;
+				Cell.Y += Step.Y;
+			}
+
+			if (!Grid.IsInside(Cell) || Grid.HasFlag(Cell, FDungeonGrid::DarkFlag))
+			{
+				return;
+			}
+
+			// Passo diagonal entre duas células bloqueadas: a quina fecha a visão
+			if (Cell.X != Previous.X && Cell.Y != Previous.Y
+				&& BlocksSight(FIntPoint(Cell.X, Previous.Y)) && BlocksSight(FIntPoint(Previous.X, Cell.Y)))
+			{
+				return;
+			}
+
+			// A parede/porta aparece no mapa, mas bloqueia o resto do raio
+			MarkSeen(Cell);
+			if (BlocksSight(Cell))
+			{
+				return;
+			}
+		}
+	};
+
+	for (int32 Offset = -Radius; Offset <= Radius; Offset++)
+	{
+		CastRay(Origin + FIntPoint(Offset, -Radius));
+		CastRay(Origin + FIntPoint(Offset, Radius));
+		CastRay(Origin + FIntPoint(-Radius, Offset));
+		CastRay(Origin + FIntPoint(Radius, Offset));
+	}
+}
+
+void FExplorationMap::MarkAllDirty()
+{
+	DirtyRect = FIntRect(0, 0, Width, Height);
+	bDirty = Width > 0 && Height > 0;
+}
+
+bool FExplorationMap::ConsumeDirtyRect(FIntRect& OutRect)
+{
+	if (!bDirty)
+	{
+		return false;
+	}
+
+	OutRect = DirtyRect;
+	bDirty = false;
+	return true;
+}
+
+void FExplorationMap::ExpandDirtyRect(FIntPoint Cell)
+{
+	if (!bDirty)
+	{
+		DirtyRect = FIntRect(Cell, Cell + FIntPoint(1, 1));
+		bDirty = true;
+	}
+	else
+	{
+		DirtyRect.Include(Cell);
+		DirtyRect.Max = DirtyRect.Max.ComponentMax(Cell + FIntPoint(1, 1));
+	}
+}
+
+void FExplorationMap::Serialize(FArchive& Ar)
+{
+	Ar << Width;
+	Ar << Height;
+
+	if (Ar.IsLoading())
+	{
+		Init(FMath::Max(0, Width), FMath::Max(0, Height));
+		LoadRuns(Ar, Visited);
+		LoadRuns(Ar, Seen);
+		MarkAllDirty();
+	}
+	else
+	{
+		SaveRuns(Ar, Visited);
+		SaveRuns(Ar, Seen);
+	}
+}
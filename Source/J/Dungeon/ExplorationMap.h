@@ -0,0 +1,59 @@
+// ExplorationMap.h
+// Células visitadas/vistas de um andar (automapa)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DungeonTypes.h"
+
+/**
+ * Exploração de um andar
+ * Um bit por célula para "visitada" e outro para "vista". Cada mudança
+ * aumenta um retângulo sujo, para que o minimapa só reenvie essa área.
+ */
+struct J_API FExplorationMap
+{
+	int32 Width = 0;
+	int32 Height = 0;
+
+	TBitArray<> Visited;
+	TBitArray<> Seen;
+
+	void Init(int32 InWidth, int32 InHeight);
+
+	FORCEINLINE bool IsInside(FIntPoint Cell) const
+	{
+		return Cell.X >= 0 && Cell.Y >= 0 && Cell.X < Width && Cell.Y < Height;
+	}
+
+	bool IsVisited(FIntPoint Cell) const { return IsInside(Cell) && Visited[Cell.Y * Width + Cell.X]; }
+	bool IsSeen(FIntPoint Cell) const { return IsInside(Cell) && Seen[Cell.Y * Width + Cell.X]; }
+
+	/** Marca a célula onde o jogador pisou (também conta como vista) */
+	void MarkVisited(FIntPoint Cell);
+
+	/** Marca uma célula como vista */
+	void MarkSeen(FIntPoint Cell);
+
+	/**
+	 * Revela as células visíveis a partir de Origin: raios no grid até a borda do
+	 * quadrado de raio Radius, parando em paredes e portas. Zonas escuras não são mapeadas.
+	 */
+	void RevealLineOfSight(const FDungeonGrid& Grid, FIntPoint Origin, int32 Radius);
+
+	/** Marca o andar inteiro para redesenho (ao trocar de textura) */
+	void MarkAllDirty();
+
+	/** Retorna e limpa a área alterada desde a última chamada */
+	bool ConsumeDirtyRect(FIntRect& OutRect);
+
+	/** Grava/lê os dois bitsets comprimidos por run-length */
+	void Serialize(FArchive& Ar);
+
+private:
+	void ExpandDirtyRect(FIntPoint Cell);
+
+	/** Área alterada (Min inclusivo, Max exclusivo) */
+	FIntRect DirtyRect;
+	bool bDirty = false;
+};
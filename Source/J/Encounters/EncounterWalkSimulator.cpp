@@ -0,0 +1,101 @@
+// EncounterWalkSimulator.cpp
+
+#include "EncounterWalkSimulator.h"
+#include "RandomEncounterManager.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+namespace
+{
+	/** Passos até um encontro, como CheckForEncounter a cada passo */
+	int32 WalkUntilEncounter(const FEncounterRateParams& Params, const FRandomStream& Random, bool& bOutForced)
+	{
+		// Sem progressão possível (taxa zero): o máximo de passos garante o encontro
+		const int32 MaxSteps = FMath::Max(1, Params.MaxStepsWithoutEncounter);
+
+		for (int32 Steps = 1; ; Steps++)
+		{
+			if (Steps < Params.MinStepsBetweenEncounters)
+			{
+				continue;
+			}
+
+			const float Chance = URandomEncounterManager::ComputeEncounterChance(Steps, Params.BaseEncounterRate,
+				Params.MinStepsBetweenEncounters, Params.MaxStepsWithoutEncounter, Params.RateMultiplier);
+
+			if (Random.FRandRange(0.0f, 100.0f) < Chance)
+			{
+				bOutForced = false;
+				return Steps;
+			}
+
+			if (Steps >= MaxSteps)
+			{
+				bOutForced = true;
+				return Steps;
+			}
+		}
+	}
+}
+
+FEncounterWalkStats FEncounterWalkSimulator::Run(const FEncounterRateParams& Params, int64 NumEncounters, int32 NumThreads, int32 Seed)
+{
+	FEncounterWalkStats Total;
+	if (NumEncounters <= 0)
+	{
+		return Total;
+	}
+
+	const int64 NumBatches = (NumEncounters + EncountersPerBatch - 1) / EncountersPerBatch;
+	NumThreads = NumThreads > 0 ? NumThreads : FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	NumThreads = (int32)FMath::Clamp<int64>(NumThreads, 1, NumBatches);
+
+	TArray<FEncounterWalkStats> WorkerStats;
+	WorkerStats.SetNum(NumThreads);
+	std::atomic<int64> NextBatch { 0 };
+
+	auto WorkerBody = [&](FEncounterWalkStats& Stats)
+	{
+		FRandomStream Random;
+		for (;;)
+		{
+			const int64 Batch = NextBatch.fetch_add(1, std::memory_order_relaxed);
+			if (Batch >= NumBatches)
+			{
+				break;
+			}
+
+			// Acumulador local: o do worker só é escrito uma vez por lote
+			FEncounterWalkStats Local;
+			const int64 First = Batch * EncountersPerBatch;
+			const int64 Last = FMath::Min(First + EncountersPerBatch, NumEncounters);
+			for (int64 EncounterIndex = First; EncounterIndex < Last; EncounterIndex++)
+			{
+				Random.Initialize((int32)HashCombine(GetTypeHash(Seed), GetTypeHash(EncounterIndex)));
+
+				bool bForced = false;
+				Local.TotalSteps += WalkUntilEncounter(Params, Random, bForced);
+				Local.NumForced += bForced ? 1 : 0;
+				Local.NumEncounters++;
+			}
+			Stats.Merge(Local);
+		}
+	};
+
+	TArray<UE::Tasks::FTask> Tasks;
+	for (int32 i = 1; i < NumThreads; i++)
+	{
+		FEncounterWalkStats* Stats = &WorkerStats[i];
+		Tasks.Add(UE::Tasks::Launch(TEXT("EncounterWalkSimulator"), [&WorkerBody, Stats]() { WorkerBody(*Stats); }));
+	}
+
+	// A thread chamadora também trabalha
+	WorkerBody(WorkerStats[0]);
+	UE::Tasks::Wait(Tasks);
+
+	for (const FEncounterWalkStats& Stats : WorkerStats)
+	{
+		Total.Merge(Stats);
+	}
+	return Total;
+}
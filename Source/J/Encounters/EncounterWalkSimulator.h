@@ -0,0 +1,61 @@
+// EncounterWalkSimulator.h
+// Simulação de caminhadas para medir a taxa de encontros aleatórios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Parâmetros de taxa de encontro (os mesmos de URandomEncounterManager + FEncounterZone)
+ */
+struct FEncounterRateParams
+{
+	/** Chance base por passo (0-100) */
+	float BaseEncounterRate = 10.0f;
+
+	int32 MinStepsBetweenEncounters = 5;
+	int32 MaxStepsWithoutEncounter = 30;
+
+	/** Multiplicador total (item * zona) */
+	float RateMultiplier = 1.0f;
+};
+
+/**
+ * Totais de um lote de caminhadas (somáveis, mesclados no fim)
+ */
+struct FEncounterWalkStats
+{
+	int64 NumEncounters = 0;
+	int64 TotalSteps = 0;
+
+	/** Encontros forçados por MaxStepsWithoutEncounter */
+	int64 NumForced = 0;
+
+	void Merge(const FEncounterWalkStats& Other)
+	{
+		NumEncounters += Other.NumEncounters;
+		TotalSteps += Other.TotalSteps;
+		NumForced += Other.NumForced;
+	}
+
+	double GetAverageSteps() const { return NumEncounters > 0 ? (double)TotalSteps / NumEncounters : 0.0; }
+	double GetForcedRate() const { return NumEncounters > 0 ? (double)NumForced / NumEncounters : 0.0; }
+};
+
+/**
+ * Simulador de caminhadas até o encontro
+ * Repete a rolagem de URandomEncounterManager::CheckForEncounter passo a passo
+ * (mesma ComputeEncounterChance, mesmo FRandomStream) sem mundo nem atores.
+ * Como no FBattleSimulator, os encontros são divididos em lotes puxados por
+ * NumThreads workers e a seed de cada um vem do seu índice: os totais não
+ * dependem do número de threads.
+ */
+class J_API FEncounterWalkSimulator
+{
+public:
+	/** Encontros por lote puxado de uma vez por um worker */
+	static constexpr int32 EncountersPerBatch = 4096;
+
+	/** Simula NumEncounters caminhadas até o encontro; NumThreads <= 0 usa todos os núcleos */
+	static FEncounterWalkStats Run(const FEncounterRateParams& Params, int64 NumEncounters, int32 NumThreads, int32 Seed);
+};
@@ -0,0 +1,33 @@
+// EncounterZoneMapAsset.cpp
+
+#include "EncounterZoneMapAsset.h"
+#include "Dungeon/DungeonGenerator.h"
+
+void UEncounterZoneMapAsset::InitFromLayout(const FDungeonFloorLayout& Layout, TConstArrayView<FDungeonEncounterTable> Tables, FIntPoint InOrigin)
+{
+	Origin = InOrigin;
+	Width = Layout.Grid.Width;
+	Height = Layout.Grid.Height;
+	RegionIDs = Layout.Grid.Regions;
+
+	// Mesma convenção do gerador: região N -> tabela N - 1
+	Zones.SetNum(Tables.Num());
+	for (int32 i = 0; i < Tables.Num(); i++)
+	{
+		Zones[i].ZoneID = Tables[i].TableID;
+		Zones[i].Encounters = Tables[i].Encounters;
+	}
+}
+
+#if WITH_EDITOR
+FOnEncounterZonesEdited UEncounterZoneMapAsset::OnZonesEdited;
+
+void UEncounterZoneMapAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Edição dentro de um elemento de Zones informa qual; o resto afeta o mapa todo
+	const int32 ZoneIndex = PropertyChangedEvent.GetArrayIndex(GET_MEMBER_NAME_STRING_CHECKED(UEncounterZoneMapAsset, Zones));
+	OnZonesEdited.Broadcast(this, ZoneIndex);
+}
+#endif
@@ -0,0 +1,104 @@
+// EncounterZoneMapAsset.h
+// Zonas de encontro por região do grid
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Core/RPGTypes.h"
+#include "EncounterZoneMapAsset.generated.h"
+
+struct FDungeonFloorLayout;
+struct FDungeonEncounterTable;
+
+/**
+ * Configuração de encontros de uma zona
+ */
+USTRUCT(BlueprintType)
+struct FEncounterZone
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	FName ZoneID;
+
+	/** Encontros possíveis na zona */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter")
+	TArray<FEncounterData> Encounters;
+
+	/** Multiplicador da taxa de encontro da zona */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter", meta = (ClampMin = "0"))
+	float RateMultiplier = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter", meta = (ClampMin = "0"))
+	int32 MinStepsBetweenEncounters = 5;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounter", meta = (ClampMin = "1"))
+	int32 MaxStepsWithoutEncounter = 30;
+};
+
+#if WITH_EDITOR
+class UEncounterZoneMapAsset;
+
+/** Mapa editado e zona alterada (INDEX_NONE = regiões ou várias zonas) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEncounterZonesEdited, UEncounterZoneMapAsset* /*ZoneMap*/, int32 /*ZoneIndex*/);
+#endif
+
+/**
+ * Mapa de zonas de encontro de um andar
+ * Um byte de região por célula (0 = sem encontros); a região N usa Zones[N - 1].
+ * A consulta pela célula inteira do personagem é uma leitura de array, sem
+ * volumes de overlap nem física por passo.
+ */
+UCLASS(BlueprintType)
+class J_API UEncounterZoneMapAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Célula do mundo correspondente ao índice (0, 0) do grid */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zones")
+	FIntPoint Origin = FIntPoint::ZeroValue;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zones", meta = (ClampMin = "0"))
+	int32 Width = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zones", meta = (ClampMin = "0"))
+	int32 Height = 0;
+
+	/** Região de cada célula, linha a linha (Width * Height) */
+	UPROPERTY(EditAnywhere, Category = "Zones")
+	TArray<uint8> RegionIDs;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zones")
+	TArray<FEncounterZone> Zones;
+
+	/** Região da célula (0 fora do mapa) */
+	FORCEINLINE uint8 GetRegionAtCell(FIntPoint Cell) const
+	{
+		const FIntPoint Local = Cell - Origin;
+		if (Local.X < 0 || Local.Y < 0 || Local.X >= Width || Local.Y >= Height)
+		{
+			return 0;
+		}
+
+		const int32 Index = Local.Y * Width + Local.X;
+		return RegionIDs.IsValidIndex(Index) ? RegionIDs[Index] : 0;
+	}
+
+	/** Zona de uma região (nullptr = sem encontros) */
+	FORCEINLINE const FEncounterZone* GetZone(uint8 Region) const
+	{
+		return Region > 0 && Zones.IsValidIndex(Region - 1) ? &Zones[Region - 1] : nullptr;
+	}
+
+	/** Preenche o mapa com as regiões de um andar gerado (uma zona por tabela) */
+	void InitFromLayout(const FDungeonFloorLayout& Layout, TConstArrayView<FDungeonEncounterTable> Tables, FIntPoint InOrigin = FIntPoint::ZeroValue);
+
+#if WITH_EDITOR
+	/** Avisa os gerenciadores em jogo (PIE) para reaplicar a zona editada sem recarregar o nível */
+	static FOnEncounterZonesEdited OnZonesEdited;
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+};
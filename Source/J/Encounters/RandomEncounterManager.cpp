@@ -1,6 +1,9 @@
 // RandomEncounterManager.cpp
 
 #include "RandomEncounterManager.h"
+#include "EncounterZoneMapAsset.h"
+#include "Characters/FirstPersonRPGCharacter.h"
+#include "Core/GridTypes.h"
 #include "TimerManager.h"
 
 URandomEncounterManager::URandomEncounterManager()
@@ -11,13 +14,100 @@ URandomEncounterManager::URandomEncounterManager()
 void URandomEncounterManager::BeginPlay()
 {
 	Super::BeginPlay();
+
+	EncounterRandom.Initialize(EncounterSeed != 0 ? EncounterSeed : FMath::Rand());
 	
+	// Seguir os passos do dono para trocar de zona ao cruzar fronteiras
+	if (AFirstPersonRPGCharacter* Character = Cast<AFirstPersonRPGCharacter>(GetOwner()))
+	{
+		Character->OnGridCellEntered.AddUObject(this, &URandomEncounterManager::HandleGridCellEntered);
+		UpdateZoneForCell(FGridMath::WorldToCell(Character->GetActorLocation(), Character->GridCellSize));
+	}
+
+#if WITH_EDITOR
+	UEncounterZoneMapAsset::OnZonesEdited.AddUObject(this, &URandomEncounterManager::HandleZonesEdited);
+#endif
+
 	UE_LOG(LogTemp, Log, TEXT("RandomEncounterManager: Iniciado! Taxa base: %.1f%%"), BaseEncounterRate);
 }
 
+void URandomEncounterManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (AFirstPersonRPGCharacter* Character = Cast<AFirstPersonRPGCharacter>(GetOwner()))
+	{
+		Character->OnGridCellEntered.RemoveAll(this);
+	}
+
+#if WITH_EDITOR
+	UEncounterZoneMapAsset::OnZonesEdited.RemoveAll(this);
+#endif
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void URandomEncounterManager::HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell)
+{
+	UpdateZoneForCell(Cell);
+}
+
+#if WITH_EDITOR
+void URandomEncounterManager::HandleZonesEdited(UEncounterZoneMapAsset* EditedMap, int32 ZoneIndex)
+{
+	// As outras zonas são lidas de novo na próxima troca de região
+	if (EditedMap != ZoneMap || (ZoneIndex != INDEX_NONE && ZoneIndex != CurrentRegion - 1))
+	{
+		return;
+	}
+
+	CurrentRegion = INDEX_NONE;
+	UpdateZoneForCell(LastCell);
+}
+#endif
+
+void URandomEncounterManager::SetZoneMap(UEncounterZoneMapAsset* InZoneMap)
+{
+	ZoneMap = InZoneMap;
+	CurrentRegion = INDEX_NONE;
+	UpdateZoneForCell(LastCell);
+}
+
+void URandomEncounterManager::UpdateZoneForCell(FIntPoint Cell)
+{
+	LastCell = Cell;
+
+	if (!ZoneMap)
+	{
+		return;
+	}
+
+	// Uma leitura de byte por passo; só há trabalho ao cruzar uma fronteira
+	const int32 Region = ZoneMap->GetRegionAtCell(Cell);
+	if (Region == CurrentRegion)
+	{
+		return;
+	}
+
+	CurrentRegion = Region;
+
+	if (const FEncounterZone* Zone = ZoneMap->GetZone((uint8)Region))
+	{
+		AreaEncounters = Zone->Encounters;
+		ZoneRateMultiplier = Zone->RateMultiplier;
+		MinStepsBetweenEncounters = Zone->MinStepsBetweenEncounters;
+		MaxStepsWithoutEncounter = Zone->MaxStepsWithoutEncounter;
+		UE_LOG(LogTemp, Log, TEXT("RandomEncounterManager: Zona %s (%d encontros)"), *Zone->ZoneID.ToString(), AreaEncounters.Num());
+	}
+	else
+	{
+		// Região sem zona: sem encontros
+		AreaEncounters.Reset();
+		ZoneRateMultiplier = 1.0f;
+	}
+}
+
 bool URandomEncounterManager::CheckForEncounter()
 {
-	if (!bEncountersEnabled || AreaEncounters.Num() == 0)
+	if (!bEncountersEnabled || bSymbolEncounters || AreaEncounters.Num() == 0)
 	{
 		return false;
 	}
@@ -34,7 +124,7 @@ bool URandomEncounterManager::CheckForEncounter()
 	float CurrentChance = CalculateCurrentEncounterChance();
 
 	// Rolar dado
-	float Roll = FMath::FRandRange(0.0f, 100.0f);
+	float Roll = EncounterRandom.FRandRange(0.0f, 100.0f);
 
 	UE_LOG(LogTemp, Verbose, TEXT("RandomEncounterManager: Passo %d, Chance: %.1f%%, Roll: %.1f"), 
 		StepsSinceLastEncounter, CurrentChance, Roll);
@@ -64,15 +154,133 @@ void URandomEncounterManager::ForceEncounter()
 		return;
 	}
 
-	FEncounterData SelectedEncounter = SelectRandomEncounter();
-	
-	UE_LOG(LogTemp, Log, TEXT("RandomEncounterManager: ENCONTRO! ID: %s"), *SelectedEncounter.EncounterID.ToString());
+	TriggerEncounter(SelectRandomEncounter());
+}
+
+void URandomEncounterManager::TriggerEncounter(const FEncounterData& Encounter)
+{
+	RollEncounterSpawn(Encounter, LastSpawn);
+
+	UE_LOG(LogTemp, Log, TEXT("RandomEncounterManager: ENCONTRO! ID: %s (%d inimigos)"), *Encounter.EncounterID.ToString(), LastSpawn.Num());
 
 	// Resetar contador
 	StepsSinceLastEncounter = 0;
 
 	// Disparar evento
-	OnEncounterTriggered.Broadcast(SelectedEncounter);
+	OnEncounterTriggered.Broadcast(Encounter, LastSpawn);
+}
+
+void URandomEncounterManager::RollEncounterSpawn(const FEncounterData& Encounter, FEncounterSpawnDescriptor& OutSpawn) const
+{
+	OutSpawn.Reset();
+
+	const int32 NumTypes = FMath::Min(Encounter.GetNumEnemyTypes(), 255);
+	if (NumTypes == 0)
+	{
+		return;
+	}
+
+	// Formação (por peso); limita a quantidade de inimigos aos slots dela.
+	// Formações sem slots são ignoradas; sem nenhuma utilizável, os inimigos ficam em linha
+	auto GetFormationWeight = [](const FEncounterFormation& Formation)
+	{
+		return Formation.Slots.Num() > 0 ? FMath::Max(0.0f, Formation.Weight) : 0.0f;
+	};
+
+	float TotalFormationWeight = 0.0f;
+	for (const FEncounterFormation& Formation : Encounter.Formations)
+	{
+		TotalFormationWeight += GetFormationWeight(Formation);
+	}
+
+	int32 MaxSlots = 255;
+	if (TotalFormationWeight > 0.0f)
+	{
+		const float RandomValue = EncounterRandom.FRandRange(0.0f, TotalFormationWeight);
+		float CurrentWeight = 0.0f;
+		for (int32 i = 0; i < Encounter.Formations.Num(); i++)
+		{
+			const float Weight = GetFormationWeight(Encounter.Formations[i]);
+			if (Weight <= 0.0f)
+			{
+				continue;
+			}
+
+			// Última utilizável cobre o arredondamento do float
+			OutSpawn.FormationIndex = i;
+			CurrentWeight += Weight;
+			if (RandomValue <= CurrentWeight)
+			{
+				break;
+			}
+		}
+
+		MaxSlots = FMath::Min(Encounter.Formations[OutSpawn.FormationIndex].Slots.Num(), 255);
+	}
+
+	const int32 MinCount = FMath::Max(1, Encounter.MinEnemies);
+	const int32 MaxCount = FMath::Max(MinCount, Encounter.MaxEnemies);
+	const int32 Count = FMath::Min(EncounterRandom.RandRange(MinCount, MaxCount), MaxSlots);
+
+	OutSpawn.EnemyCounts.SetNumZeroed(NumTypes);
+	OutSpawn.EnemyIndices.Reserve(Count);
+	OutSpawn.SlotIndices.Reserve(Count);
+
+	for (int32 Slot = 0; Slot < Count; Slot++)
+	{
+		// Peso de cada tipo, zerado quando o tipo atingiu MaxCount
+		float TotalWeight = 0.0f;
+		for (int32 Type = 0; Type < NumTypes; Type++)
+		{
+			if (Encounter.EnemyEntries.Num() == 0)
+			{
+				TotalWeight += 1.0f;
+				continue;
+			}
+
+			const FEncounterEnemyEntry& Entry = Encounter.EnemyEntries[Type];
+			if (Entry.MaxCount <= 0 || OutSpawn.EnemyCounts[Type] < Entry.MaxCount)
+			{
+				TotalWeight += Entry.Weight;
+			}
+		}
+
+		if (TotalWeight <= 0.0f)
+		{
+			// Todos os tipos no limite: grupo menor
+			break;
+		}
+
+		const float RandomValue = EncounterRandom.FRandRange(0.0f, TotalWeight);
+		float CurrentWeight = 0.0f;
+		int32 Chosen = INDEX_NONE;
+		for (int32 Type = 0; Type < NumTypes; Type++)
+		{
+			if (Encounter.EnemyEntries.Num() == 0)
+			{
+				CurrentWeight += 1.0f;
+			}
+			else
+			{
+				const FEncounterEnemyEntry& Entry = Encounter.EnemyEntries[Type];
+				if (Entry.MaxCount > 0 && OutSpawn.EnemyCounts[Type] >= Entry.MaxCount)
+				{
+					continue;
+				}
+				CurrentWeight += Entry.Weight;
+			}
+
+			Chosen = Type;
+			if (RandomValue <= CurrentWeight)
+			{
+				break;
+			}
+		}
+
+		OutSpawn.EnemyIndices.Add((uint8)Chosen);
+		OutSpawn.SlotIndices.Add((uint8)Slot);
+		OutSpawn.EnemyCounts[Chosen]++;
+	}
 }
 
 FEncounterData URandomEncounterManager::SelectRandomEncounter() const
@@ -90,7 +298,7 @@ FEncounterData URandomEncounterManager::SelectRandomEncounter() const
 	}
 
 	// Selecionar baseado em peso
-	float RandomValue = FMath::FRandRange(0.0f, TotalWeight);
+	float RandomValue = EncounterRandom.FRandRange(0.0f, TotalWeight);
 	float CurrentWeight = 0.0f;
 
 	for (const FEncounterData& Encounter : AreaEncounters)
@@ -144,16 +352,22 @@ void URandomEncounterManager::EnableEncounters()
 }
 
 float URandomEncounterManager::CalculateCurrentEncounterChance() const
+{
+	return ComputeEncounterChance(StepsSinceLastEncounter, BaseEncounterRate, MinStepsBetweenEncounters,
+		MaxStepsWithoutEncounter, EncounterRateMultiplier * ZoneRateMultiplier);
+}
+
+float URandomEncounterManager::ComputeEncounterChance(int32 Steps, float BaseRate, int32 MinSteps, int32 MaxSteps, float RateMultiplier)
 {
 	// Chance aumenta progressivamente após o mínimo de passos
-	int32 StepsOverMinimum = StepsSinceLastEncounter - MinStepsBetweenEncounters;
+	int32 StepsOverMinimum = Steps - MinSteps;
 	
 	// Fórmula: BaseRate + (StepsOverMinimum * incremento)
 	// Incremento faz a chance aumentar gradualmente
-	float IncrementPerStep = (100.0f - BaseEncounterRate) / (MaxStepsWithoutEncounter - MinStepsBetweenEncounters);
+	float IncrementPerStep = (100.0f - BaseRate) / FMath::Max(1, MaxSteps - MinSteps);
 	
-	float CurrentChance = BaseEncounterRate + (StepsOverMinimum * IncrementPerStep);
-	CurrentChance *= EncounterRateMultiplier;
+	float CurrentChance = BaseRate + (StepsOverMinimum * IncrementPerStep);
+	CurrentChance *= RateMultiplier;
 	
 	return FMath::Clamp(CurrentChance, 0.0f, 100.0f);
 }
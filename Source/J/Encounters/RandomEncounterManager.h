@@ -8,7 +8,10 @@
 #include "Core/RPGTypes.h"
 #include "RandomEncounterManager.generated.h"
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEncounterTriggered, const FEncounterData&, EncounterData);
+class UEncounterZoneMapAsset;
+class AFirstPersonRPGCharacter;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEncounterTriggered, const FEncounterData&, EncounterData, const FEncounterSpawnDescriptor&, Spawn);
 
 /**
  * Componente que gerencia encontros aleatórios
@@ -24,6 +27,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	// ==================== CONFIGURAÇÕES ====================
@@ -44,17 +48,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounters")
 	int32 MaxStepsWithoutEncounter = 30;
 
+	/** Encontros por símbolo (grupos visíveis no mapa): desliga as rolagens por passo */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounters")
+	bool bSymbolEncounters = false;
+
 	/** Lista de encontros possíveis na área atual */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounters")
 	TArray<FEncounterData> AreaEncounters;
 
+	/** Seed do RNG de encontros (0 = aleatória) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Encounters")
+	int32 EncounterSeed = 0;
+
 	/** Multiplicador de taxa de encontro (itens podem modificar) */
 	UPROPERTY(BlueprintReadWrite, Category = "Encounters")
 	float EncounterRateMultiplier = 1.0f;
 
+	// ==================== ZONAS ====================
+
+	/**
+	 * Zonas do andar atual. Se definido, a lista de encontros, a taxa e os
+	 * limites de passos acompanham a região da célula do dono automaticamente.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Encounters|Zones")
+	UEncounterZoneMapAsset* ZoneMap = nullptr;
+
+	/** Região atual no ZoneMap (0 = sem encontros, INDEX_NONE = ainda não avaliada) */
+	UPROPERTY(BlueprintReadOnly, Category = "Encounters|Zones")
+	int32 CurrentRegion = INDEX_NONE;
+
 	// ==================== EVENTOS ====================
 
-	/** Chamado quando um encontro é acionado */
+	/** Chamado quando um encontro é acionado, já com a composição sorteada */
 	UPROPERTY(BlueprintAssignable, Category = "Encounters")
 	FOnEncounterTriggered OnEncounterTriggered;
 
@@ -68,14 +93,41 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Encounters")
 	void ForceEncounter();
 
+	/** Dispara um encontro específico (ex.: contato com um grupo visível) e sorteia sua composição */
+	UFUNCTION(BlueprintCallable, Category = "Encounters")
+	void TriggerEncounter(const FEncounterData& Encounter);
+
 	/** Seleciona um encontro aleatório da lista */
 	UFUNCTION(BlueprintCallable, Category = "Encounters")
 	FEncounterData SelectRandomEncounter() const;
 
+	/**
+	 * Sorteia quantidade, formação e inimigos de um encontro com o RNG de encontros.
+	 * OutSpawn é reutilizado; a quantidade respeita Min/MaxEnemies e os slots da formação.
+	 */
+	void RollEncounterSpawn(const FEncounterData& Encounter, FEncounterSpawnDescriptor& OutSpawn) const;
+
+	/** Última composição sorteada */
+	const FEncounterSpawnDescriptor& GetLastSpawn() const { return LastSpawn; }
+
+	/**
+	 * Chance de encontro (0-100) no passo Steps desde o último encontro
+	 * Fórmula única do jogo, usada também pelo FEncounterWalkSimulator.
+	 */
+	static float ComputeEncounterChance(int32 Steps, float BaseRate, int32 MinSteps, int32 MaxSteps, float RateMultiplier);
+
 	/** Define a lista de encontros da área atual */
 	UFUNCTION(BlueprintCallable, Category = "Encounters")
 	void SetAreaEncounters(const TArray<FEncounterData>& NewEncounters);
 
+	/** Troca o mapa de zonas (ao mudar de andar) e reavalia a célula atual */
+	UFUNCTION(BlueprintCallable, Category = "Encounters|Zones")
+	void SetZoneMap(UEncounterZoneMapAsset* InZoneMap);
+
+	/** Aplica a zona da célula se a região mudou (chamado a cada passo do dono) */
+	UFUNCTION(BlueprintCallable, Category = "Encounters|Zones")
+	void UpdateZoneForCell(FIntPoint Cell);
+
 	/** Reseta o contador de passos */
 	UFUNCTION(BlueprintCallable, Category = "Encounters")
 	void ResetStepCounter();
@@ -93,9 +145,28 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Encounters")
 	int32 StepsSinceLastEncounter = 0;
 
+	/** RNG de encontros (taxa, escolha do encontro e composição) */
+	FRandomStream EncounterRandom;
+
+	/** Composição do último encontro (reaproveitada entre encontros) */
+	FEncounterSpawnDescriptor LastSpawn;
+
 	/** Handle do timer para reabilitar encontros */
 	FTimerHandle ReenableEncountersTimer;
 
 	/** Calcula a chance atual de encontro */
 	float CalculateCurrentEncounterChance() const;
+
+	/** Multiplicador de taxa da zona atual */
+	float ZoneRateMultiplier = 1.0f;
+
+	/** Última célula do dono (para reavaliar ao trocar de mapa) */
+	FIntPoint LastCell = FIntPoint::ZeroValue;
+
+	void HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell);
+
+#if WITH_EDITOR
+	/** Zona editada durante o PIE: reaplica só se for a zona em uso */
+	void HandleZonesEdited(UEncounterZoneMapAsset* EditedMap, int32 ZoneIndex);
+#endif
 };
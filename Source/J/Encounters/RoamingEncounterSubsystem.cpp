@@ -0,0 +1,187 @@
+// RoamingEncounterSubsystem.cpp
+
+#include "RoamingEncounterSubsystem.h"
+#include "RandomEncounterManager.h"
+#include "Characters/FirstPersonRPGCharacter.h"
+#include "Dungeon/DungeonStreamingSubsystem.h"
+#include "Dungeon/DungeonFloorAsset.h"
+#include "Core/GridTypes.h"
+
+void URoamingEncounterSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UDungeonStreamingSubsystem* Streaming = Collection.InitializeDependency<UDungeonStreamingSubsystem>())
+	{
+		Streaming->OnFloorChanged.AddUObject(this, &URoamingEncounterSubsystem::HandleFloorChanged);
+	}
+}
+
+void URoamingEncounterSubsystem::Deinitialize()
+{
+	if (AFirstPersonRPGCharacter* Character = TrackedCharacter.Get())
+	{
+		Character->OnGridCellEntered.RemoveAll(this);
+	}
+
+	if (UDungeonStreamingSubsystem* Streaming = GetWorld()->GetSubsystem<UDungeonStreamingSubsystem>())
+	{
+		Streaming->OnFloorChanged.RemoveAll(this);
+	}
+
+	Roaming.Reset();
+	Super::Deinitialize();
+}
+
+void URoamingEncounterSubsystem::SetTrackedCharacter(AFirstPersonRPGCharacter* Character)
+{
+	if (AFirstPersonRPGCharacter* Previous = TrackedCharacter.Get())
+	{
+		Previous->OnGridCellEntered.RemoveAll(this);
+	}
+
+	TrackedCharacter = Character;
+
+	if (Character)
+	{
+		Character->OnGridCellEntered.AddUObject(this, &URoamingEncounterSubsystem::HandleGridCellEntered);
+	}
+}
+
+void URoamingEncounterSubsystem::PopulateFloor(const TArray<FEncounterData>& InEncounters, int32 NumGroups, int32 Seed)
+{
+	ClearFloor();
+
+	const UDungeonStreamingSubsystem* Streaming = GetWorld()->GetSubsystem<UDungeonStreamingSubsystem>();
+	const UDungeonFloorAsset* Floor = Streaming ? Streaming->GetFloor() : nullptr;
+	if (!Floor || Floor->Grid.Width <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("RoamingEncounters: Nenhum andar com grid carregado"));
+		return;
+	}
+
+	Encounters = InEncounters;
+	Random.Initialize(Seed);
+	Roaming.Initialize(Floor->Grid);
+	Roaming.Populate(NumGroups, Encounters.Num(), Random);
+	GroupVisuals.Init(nullptr, Roaming.Num());
+
+	if (const AFirstPersonRPGCharacter* Character = TrackedCharacter.Get())
+	{
+		UpdateVisuals(Character->GetCurrentGridCell());
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("RoamingEncounters: %d grupos no andar"), Roaming.Num());
+}
+
+void URoamingEncounterSubsystem::ClearFloor()
+{
+	for (int32 i = 0; i < GroupVisuals.Num(); i++)
+	{
+		ReleaseVisual(i);
+	}
+
+	GroupVisuals.Reset();
+	Roaming.Reset();
+	Encounters.Reset();
+}
+
+void URoamingEncounterSubsystem::HandleFloorChanged(UDungeonFloorAsset* NewFloor)
+{
+	if (Roaming.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("RoamingEncounters: Andar trocado, %d grupos descartados"), Roaming.Num());
+	}
+
+	// O novo andar é povoado de novo por PopulateFloor
+	ClearFloor();
+}
+
+void URoamingEncounterSubsystem::HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell)
+{
+	if (Roaming.Num() == 0)
+	{
+		return;
+	}
+
+	// Todos os grupos andam juntos
+	Roaming.Update(Cell, Random, Contacts);
+
+	if (Contacts.Num() > 0)
+	{
+		// Um combate por passo: o primeiro contato vira o encontro, os outros grupos somem junto
+		const FEncounterData& Encounter = Encounters[Roaming.GetGroup(Contacts[0]).EncounterIndex];
+		if (URandomEncounterManager* EncounterManager = Character->FindComponentByClass<URandomEncounterManager>())
+		{
+			EncounterManager->TriggerEncounter(Encounter);
+		}
+
+		// Remover do maior índice para o menor (RemoveAtSwap não afeta os restantes)
+		for (int32 i = Contacts.Num() - 1; i >= 0; i--)
+		{
+			const int32 GroupIndex = Contacts[i];
+			ReleaseVisual(GroupIndex);
+			Roaming.RemoveGroup(GroupIndex);
+			GroupVisuals.RemoveAtSwap(GroupIndex, 1, EAllowShrinking::No);
+		}
+	}
+
+	UpdateVisuals(Cell);
+}
+
+void URoamingEncounterSubsystem::UpdateVisuals(FIntPoint PlayerCell)
+{
+	const AFirstPersonRPGCharacter* Character = TrackedCharacter.Get();
+	if (!SymbolActorClass || !Character)
+	{
+		return;
+	}
+
+	const float CellSize = Character->GridCellSize;
+	const float Height = Character->GetActorLocation().Z;
+
+	for (int32 i = 0; i < Roaming.Num(); i++)
+	{
+		const FRoamingGroup& Group = Roaming.GetGroup(i);
+		const FIntPoint Delta = Group.Cell - PlayerCell;
+		const bool bNear = FMath::Max(FMath::Abs(Delta.X), FMath::Abs(Delta.Y)) <= VisualRadius;
+
+		if (!bNear)
+		{
+			ReleaseVisual(i);
+			continue;
+		}
+
+		AActor*& Visual = GroupVisuals[i];
+		if (!Visual)
+		{
+			if (FreeVisuals.Num() > 0)
+			{
+				Visual = FreeVisuals.Pop(EAllowShrinking::No);
+				Visual->SetActorHiddenInGame(false);
+			}
+			else
+			{
+				FActorSpawnParameters SpawnParams;
+				SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+				Visual = GetWorld()->SpawnActor<AActor>(SymbolActorClass, FTransform::Identity, SpawnParams);
+			}
+		}
+
+		if (Visual)
+		{
+			Visual->SetActorLocationAndRotation(FGridMath::CellToWorld(Group.Cell, CellSize, Height), FRotator(0.0f, Group.Facing * 90.0f, 0.0f));
+		}
+	}
+}
+
+void URoamingEncounterSubsystem::ReleaseVisual(int32 GroupIndex)
+{
+	AActor*& Visual = GroupVisuals[GroupIndex];
+	if (Visual)
+	{
+		Visual->SetActorHiddenInGame(true);
+		FreeVisuals.Add(Visual);
+		Visual = nullptr;
+	}
+}
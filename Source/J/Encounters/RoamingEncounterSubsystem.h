@@ -0,0 +1,85 @@
+// RoamingEncounterSubsystem.h
+// Encontros por símbolo: grupos visíveis que andam no grid
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/RPGTypes.h"
+#include "RoamingEncounterSystem.h"
+#include "RoamingEncounterSubsystem.generated.h"
+
+class AFirstPersonRPGCharacter;
+class UDungeonFloorAsset;
+
+/**
+ * Encontros por símbolo no andar atual
+ * Os grupos vivem em FRoamingEncounterSystem e avançam juntos a cada passo
+ * do jogador. Só os grupos a até VisualRadius células ganham um ator visual,
+ * vindo de um pool reaproveitado. Encostar em um grupo dispara o encontro
+ * pelo URandomEncounterManager do jogador, igual a um encontro aleatório.
+ */
+UCLASS()
+class J_API URoamingEncounterSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Ator que representa um grupo próximo */
+	UPROPERTY(BlueprintReadWrite, Category = "Encounters|Symbol")
+	TSubclassOf<AActor> SymbolActorClass;
+
+	/** Distância (Chebyshev, em células) para um grupo ganhar ator visual */
+	UPROPERTY(BlueprintReadWrite, Category = "Encounters|Symbol")
+	int32 VisualRadius = 6;
+
+	/**
+	 * Preenche o andar atual (UDungeonStreamingSubsystem) com grupos.
+	 * Cada grupo sorteia um dos Encounters.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Encounters|Symbol")
+	void PopulateFloor(const TArray<FEncounterData>& InEncounters, int32 NumGroups, int32 Seed);
+
+	/** Remove todos os grupos e atores (também ao trocar de andar) */
+	UFUNCTION(BlueprintCallable, Category = "Encounters|Symbol")
+	void ClearFloor();
+
+	UFUNCTION(BlueprintPure, Category = "Encounters|Symbol")
+	int32 GetNumGroups() const { return Roaming.Num(); }
+
+	/** Passa a seguir os passos deste personagem */
+	void SetTrackedCharacter(AFirstPersonRPGCharacter* Character);
+
+private:
+	/** Os grupos apontam para o grid do andar anterior: descartar */
+	void HandleFloorChanged(UDungeonFloorAsset* NewFloor);
+
+	void HandleGridCellEntered(AFirstPersonRPGCharacter* Character, FIntPoint Cell);
+
+	/** Dá/tira atores visuais conforme a distância e posiciona os visíveis */
+	void UpdateVisuals(FIntPoint PlayerCell);
+
+	void ReleaseVisual(int32 GroupIndex);
+
+	FRoamingEncounterSystem Roaming;
+	FRandomStream Random;
+
+	/** Encontros sorteáveis (FRoamingGroup::EncounterIndex aponta para cá) */
+	TArray<FEncounterData> Encounters;
+
+	/** Ator visual de cada grupo (paralelo aos grupos; nullptr = longe) */
+	UPROPERTY(Transient)
+	TArray<AActor*> GroupVisuals;
+
+	/** Atores escondidos prontos para reuso */
+	UPROPERTY(Transient)
+	TArray<AActor*> FreeVisuals;
+
+	/** Buffer reutilizado de contatos */
+	TArray<int32> Contacts;
+
+	TWeakObjectPtr<AFirstPersonRPGCharacter> TrackedCharacter;
+};
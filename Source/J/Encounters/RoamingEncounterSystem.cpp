@@ -0,0 +1,149 @@
+// RoamingEncounterSystem.cpp
+
+#include "RoamingEncounterSystem.h"
+#include "Core/GridTypes.h"
+
+void FRoamingEncounterSystem::Initialize(const FDungeonGrid& InGrid)
+{
+	Grid = &InGrid;
+	Groups.Reset();
+	Occupied.Init(false, InGrid.Width * InGrid.Height);
+}
+
+void FRoamingEncounterSystem::Reset()
+{
+	Grid = nullptr;
+	Groups.Reset();
+	Occupied.Empty();
+}
+
+bool FRoamingEncounterSystem::AddGroup(FIntPoint Cell, uint16 EncounterIndex, uint8 Facing)
+{
+	if (!Grid || !Grid->IsWalkable(Cell) || Occupied[Grid->ToIndex(Cell)])
+	{
+		return false;
+	}
+
+	FRoamingGroup& Group = Groups.AddDefaulted_GetRef();
+	Group.Cell = Cell;
+	Group.Facing = Facing & 3;
+	Group.EncounterIndex = EncounterIndex;
+	Occupied[Grid->ToIndex(Cell)] = true;
+	return true;
+}
+
+void FRoamingEncounterSystem::Populate(int32 NumGroups, int32 NumEncounters, FRandomStream& Random)
+{
+	if (!Grid || Grid->Width <= 0 || Grid->Height <= 0 || NumEncounters <= 0)
+	{
+		return;
+	}
+
+	Groups.Reserve(Groups.Num() + NumGroups);
+
+	// Tentativas limitadas: andares quase cheios simplesmente recebem menos grupos
+	for (int32 Attempt = 0, Added = 0; Attempt < NumGroups * 4 && Added < NumGroups; Attempt++)
+	{
+		const FIntPoint Cell(Random.RandRange(0, Grid->Width - 1), Random.RandRange(0, Grid->Height - 1));
+		const uint16 EncounterIndex = (uint16)Random.RandRange(0, FMath::Min(NumEncounters, (int32)MAX_uint16) - 1);
+		if (AddGroup(Cell, EncounterIndex, (uint8)Random.RandRange(0, 3)))
+		{
+			Added++;
+		}
+	}
+}
+
+bool FRoamingEncounterSystem::CanEnter(FIntPoint Cell, FIntPoint PlayerCell) const
+{
+	return Cell == PlayerCell || (Grid->IsWalkable(Cell) && !Occupied[Grid->ToIndex(Cell)]);
+}
+
+void FRoamingEncounterSystem::MoveGroup(FRoamingGroup& Group, FIntPoint NewCell)
+{
+	Occupied[Grid->ToIndex(Group.Cell)] = false;
+	Occupied[Grid->ToIndex(NewCell)] = true;
+	Group.Cell = NewCell;
+}
+
+void FRoamingEncounterSystem::Update(FIntPoint PlayerCell, FRandomStream& Random, TArray<int32>& OutContacts)
+{
+	OutContacts.Reset();
+	if (!Grid)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Groups.Num(); i++)
+	{
+		FRoamingGroup& Group = Groups[i];
+
+		// O jogador pisou no grupo
+		if (Group.Cell == PlayerCell)
+		{
+			OutContacts.Add(i);
+			continue;
+		}
+
+		const FIntPoint Delta = PlayerCell - Group.Cell;
+		const int32 Distance = FMath::Abs(Delta.X) + FMath::Abs(Delta.Y);
+		Group.State = Distance <= SightRange ? ERoamingState::Chase : ERoamingState::Patrol;
+
+		if (Group.State == ERoamingState::Chase)
+		{
+			// Eixo com maior distância primeiro; se bloqueado, tenta o outro
+			const bool bXFirst = FMath::Abs(Delta.X) >= FMath::Abs(Delta.Y);
+			const FIntPoint StepX(FMath::Sign(Delta.X), 0);
+			const FIntPoint StepY(0, FMath::Sign(Delta.Y));
+			const FIntPoint First = bXFirst ? StepX : StepY;
+			const FIntPoint Second = bXFirst ? StepY : StepX;
+
+			FIntPoint Step = FIntPoint::ZeroValue;
+			if (First != FIntPoint::ZeroValue && CanEnter(Group.Cell + First, PlayerCell))
+			{
+				Step = First;
+			}
+			else if (Second != FIntPoint::ZeroValue && CanEnter(Group.Cell + Second, PlayerCell))
+			{
+				Step = Second;
+			}
+
+			if (Step != FIntPoint::ZeroValue)
+			{
+				MoveGroup(Group, Group.Cell + Step);
+				Group.Facing = Step.X > 0 ? 0 : Step.Y > 0 ? 1 : Step.X < 0 ? 2 : 3;
+			}
+		}
+		else
+		{
+			// Patrulha: segue reto; bloqueado, vira para um lado (ou volta)
+			FIntPoint Next = Group.Cell + FGridMath::FacingToCellStep(Group.Facing);
+			if (!CanEnter(Next, PlayerCell))
+			{
+				const uint8 Turn = (uint8)Random.RandRange(1, 3);
+				Group.Facing = (Group.Facing + Turn) & 3;
+				Next = Group.Cell + FGridMath::FacingToCellStep(Group.Facing);
+			}
+
+			if (CanEnter(Next, PlayerCell))
+			{
+				MoveGroup(Group, Next);
+			}
+		}
+
+		if (Group.Cell == PlayerCell)
+		{
+			OutContacts.Add(i);
+		}
+	}
+}
+
+void FRoamingEncounterSystem::RemoveGroup(int32 GroupIndex)
+{
+	if (!Groups.IsValidIndex(GroupIndex))
+	{
+		return;
+	}
+
+	Occupied[Grid->ToIndex(Groups[GroupIndex].Cell)] = false;
+	Groups.RemoveAtSwap(GroupIndex, 1, EAllowShrinking::No);
+}
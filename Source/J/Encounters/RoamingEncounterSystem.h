@@ -0,0 +1,80 @@
+// RoamingEncounterSystem.h
+// Grupos de inimigos visíveis no grid (symbol encounters)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Dungeon/DungeonTypes.h"
+
+/**
+ * Estado de IA de um grupo
+ */
+enum class ERoamingState : uint8
+{
+	Patrol,
+	Chase
+};
+
+/**
+ * Grupo de inimigos no grid (registro leve, sem ator nem tick)
+ */
+struct FRoamingGroup
+{
+	FIntPoint Cell = FIntPoint::ZeroValue;
+
+	/** Direção 0-3 (ver FGridMath::FacingToCellStep) */
+	uint8 Facing = 0;
+
+	ERoamingState State = ERoamingState::Patrol;
+
+	/** Índice na lista de encontros do andar */
+	uint16 EncounterIndex = 0;
+};
+
+/**
+ * Simulação dos grupos de um andar
+ * Todos os grupos avançam juntos, uma vez por passo do jogador: perseguem o
+ * jogador dentro de SightRange e patrulham em linha reta no resto do tempo.
+ * Cada grupo custa O(1) por passo; a ocupação do grid é um bitset, então
+ * grupos não se sobrepõem.
+ */
+struct J_API FRoamingEncounterSystem
+{
+	/** Distância (Manhattan, em células) em que um grupo começa a perseguir */
+	int32 SightRange = 5;
+
+	/** Reinicia com o grid do andar */
+	void Initialize(const FDungeonGrid& InGrid);
+
+	void Reset();
+
+	/** Adiciona um grupo (false se a célula não for caminhável ou já estiver ocupada) */
+	bool AddGroup(FIntPoint Cell, uint16 EncounterIndex, uint8 Facing = 0);
+
+	/** Espalha grupos em células caminháveis aleatórias */
+	void Populate(int32 NumGroups, int32 NumEncounters, FRandomStream& Random);
+
+	/**
+	 * Avança todos os grupos um passo. Índices dos grupos que encostaram no
+	 * jogador vão para OutContacts (o chamador decide removê-los).
+	 */
+	void Update(FIntPoint PlayerCell, FRandomStream& Random, TArray<int32>& OutContacts);
+
+	/** Remove um grupo (troca com o último: índices de grupos podem mudar) */
+	void RemoveGroup(int32 GroupIndex);
+
+	int32 Num() const { return Groups.Num(); }
+	const FRoamingGroup& GetGroup(int32 Index) const { return Groups[Index]; }
+
+private:
+	bool CanEnter(FIntPoint Cell, FIntPoint PlayerCell) const;
+	void MoveGroup(FRoamingGroup& Group, FIntPoint NewCell);
+
+	/** Grid do andar (não é dono; quem chama Initialize precisa chamar Reset antes de o andar mudar) */
+	const FDungeonGrid* Grid = nullptr;
+	TArray<FRoamingGroup> Groups;
+
+	/** Um bit por célula do andar */
+	TBitArray<> Occupied;
+};
@@ -0,0 +1,115 @@
+// FusionChartAsset.cpp
+
+#include "FusionChartAsset.h"
+#include "UObject/ObjectSaveContext.h"
+
+const FFusionEngine& UFusionChartAsset::GetEngine() const
+{
+	if (!bEngineBuilt)
+	{
+		const_cast<UFusionChartAsset*>(this)->BuildEngine();
+	}
+	return Engine;
+}
+
+FName UFusionChartAsset::GetFusionResult(FName DemonA, FName DemonB) const
+{
+	const FFusionEngine& FusionEngine = GetEngine();
+	const int32 Result = FusionEngine.Fuse(FusionEngine.FindDemon(DemonA), FusionEngine.FindDemon(DemonB));
+	return Result != INDEX_NONE ? FusionEngine.GetDemon(Result).DemonID : NAME_None;
+}
+
+void UFusionChartAsset::GetRecipesFor(FName Result, TArray<FName>& OutDemonsA, TArray<FName>& OutDemonsB) const
+{
+	const FFusionEngine& FusionEngine = GetEngine();
+	TConstArrayView<FFusionPair> Recipes = FusionEngine.GetRecipes(FusionEngine.FindDemon(Result));
+
+	OutDemonsA.Reset(Recipes.Num());
+	OutDemonsB.Reset(Recipes.Num());
+	for (const FFusionPair& Pair : Recipes)
+	{
+		OutDemonsA.Add(FusionEngine.GetDemon(Pair.A).DemonID);
+		OutDemonsB.Add(FusionEngine.GetDemon(Pair.B).DemonID);
+	}
+}
+
+void UFusionChartAsset::BuildEngine()
+{
+	TArray<FFusionDemon> EngineDemons;
+	EngineDemons.Reserve(Demons.Num());
+	for (const FFusionDemonDef& Def : Demons)
+	{
+		FFusionDemon& Demon = EngineDemons.AddDefaulted_GetRef();
+		Demon.DemonID = Def.DemonID;
+		Demon.Race = Def.Race;
+		Demon.Level = Def.Level;
+		Demon.Skills = Def.Skills;
+	}
+
+	uint8 RaceChart[FFusionEngine::NumRaces * FFusionEngine::NumRaces];
+	FMemory::Memset(RaceChart, FFusionEngine::NoRace, sizeof(RaceChart));
+	for (const FFusionRaceRule& Rule : RaceRules)
+	{
+		if (Rule.RaceA < EDemonRace::MAX && Rule.RaceB < EDemonRace::MAX && Rule.Result < EDemonRace::MAX)
+		{
+			RaceChart[(int32)Rule.RaceA * FFusionEngine::NumRaces + (int32)Rule.RaceB] = (uint8)Rule.Result;
+			RaceChart[(int32)Rule.RaceB * FFusionEngine::NumRaces + (int32)Rule.RaceA] = (uint8)Rule.Result;
+		}
+	}
+
+	// Tabela do cook só vale se foi gerada a partir destes mesmos dados
+	TConstArrayView<int16> Precomputed;
+	if (BakedSourceHash == ComputeSourceHash())
+	{
+		Precomputed = BakedPairResults;
+	}
+
+	Engine.Build(MoveTemp(EngineDemons), RaceChart, Precomputed);
+	bEngineBuilt = true;
+}
+
+void UFusionChartAsset::PostLoad()
+{
+	Super::PostLoad();
+	BuildEngine();
+}
+
+void UFusionChartAsset::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// Gerar a tabela de pares no save/cook para que o runtime não precise calculá-la
+	BakedPairResults.Reset();
+	BakedSourceHash = 0;
+	BuildEngine();
+	BakedPairResults = Engine.GetPairTable();
+	BakedSourceHash = ComputeSourceHash();
+}
+
+#if WITH_EDITOR
+void UFusionChartAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	bEngineBuilt = false;
+}
+#endif
+
+uint32 UFusionChartAsset::ComputeSourceHash() const
+{
+	uint32 Hash = GetTypeHash(Demons.Num());
+	for (const FFusionDemonDef& Def : Demons)
+	{
+		// Texto do nome, não GetTypeHash(FName): o índice na tabela de nomes muda entre processos
+		// (cook x runtime) e o hash gravado no cook nunca bateria. FName ignora caixa, o hash também
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*Def.DemonID.ToString().ToLower()));
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Def.Race));
+		Hash = HashCombine(Hash, GetTypeHash(Def.Level));
+	}
+	for (const FFusionRaceRule& Rule : RaceRules)
+	{
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Rule.RaceA));
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Rule.RaceB));
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Rule.Result));
+	}
+	return Hash;
+}
@@ -0,0 +1,65 @@
+// FusionChartAsset.h
+// Data Asset com o compêndio de fusão e a tabela de raças
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "FusionTypes.h"
+#include "FusionEngine.h"
+#include "FusionChartAsset.generated.h"
+
+/**
+ * Tabela de fusão editável
+ * Ao salvar/cozinhar, a tabela de todos os pares é calculada em paralelo e
+ * gravada no asset; em runtime só o índice reverso é montado no carregamento.
+ */
+UCLASS(BlueprintType)
+class J_API UFusionChartAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Demônios que podem ser fundidos/resultar de fusão */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	TArray<FFusionDemonDef> Demons;
+
+	/** Regras raça x raça (simétricas) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	TArray<FFusionRaceRule> RaceRules;
+
+	/** Motor pronto para consultas (monta na primeira chamada se necessário) */
+	const FFusionEngine& GetEngine() const;
+
+	/** Resultado da fusão de dois demônios (NAME_None = inválida) */
+	UFUNCTION(BlueprintPure, Category = "Fusion")
+	FName GetFusionResult(FName DemonA, FName DemonB) const;
+
+	/** Pares de ingredientes que produzem um demônio */
+	UFUNCTION(BlueprintCallable, Category = "Fusion")
+	void GetRecipesFor(FName Result, TArray<FName>& OutDemonsA, TArray<FName>& OutDemonsB) const;
+
+	/** Remonta o motor a partir dos dados de autoria */
+	void BuildEngine();
+
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** Hash dos dados de autoria usados para gerar BakedPairResults */
+	uint32 ComputeSourceHash() const;
+
+	/** Tabela de pares gerada no save/cook */
+	UPROPERTY()
+	TArray<int16> BakedPairResults;
+
+	UPROPERTY()
+	uint32 BakedSourceHash = 0;
+
+	FFusionEngine Engine;
+	bool bEngineBuilt = false;
+};
@@ -0,0 +1,231 @@
+// FusionEngine.cpp
+
+#include "FusionEngine.h"
+#include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+void FFusionEngine::Build(TArray<FFusionDemon>&& InDemons, TConstArrayView<uint8> InRaceChart, TConstArrayView<int16> PrecomputedPairs)
+{
+	Demons = MoveTemp(InDemons);
+	check(Demons.Num() <= MAX_int16);
+
+	IndexByID.Reset();
+	IndexByID.Reserve(Demons.Num());
+	for (int32 i = 0; i < Demons.Num(); i++)
+	{
+		IndexByID.Add(Demons[i].DemonID, i);
+	}
+
+	// Tabela de raças (entradas ausentes = sem fusão)
+	FMemory::Memset(RaceChart, NoRace, sizeof(RaceChart));
+	if (InRaceChart.Num() == NumRaces * NumRaces)
+	{
+		FMemory::Memcpy(RaceChart, InRaceChart.GetData(), sizeof(RaceChart));
+	}
+
+	// Agrupar por raça (counting sort) e ordenar cada grupo por nível
+	RaceOffsets.Init(0, NumRaces + 1);
+	for (const FFusionDemon& Demon : Demons)
+	{
+		RaceOffsets[(int32)Demon.Race + 1]++;
+	}
+	for (int32 Race = 0; Race < NumRaces; Race++)
+	{
+		RaceOffsets[Race + 1] += RaceOffsets[Race];
+	}
+
+	RaceDemons.SetNumUninitialized(Demons.Num());
+	TArray<int32> Cursor(RaceOffsets.GetData(), NumRaces);
+	for (int32 i = 0; i < Demons.Num(); i++)
+	{
+		RaceDemons[Cursor[(int32)Demons[i].Race]++] = i;
+	}
+	for (int32 Race = 0; Race < NumRaces; Race++)
+	{
+		TArrayView<int32> Group(RaceDemons.GetData() + RaceOffsets[Race], RaceOffsets[Race + 1] - RaceOffsets[Race]);
+		Algo::StableSortBy(Group, [this](int32 Index) { return Demons[Index].Level; });
+	}
+
+	// Tabela de pares: usar a do cook se bater com o compêndio atual
+	if (PrecomputedPairs.Num() == GetPairTableSize(Demons.Num()) && Demons.Num() > 1)
+	{
+		PairResults.Reset(PrecomputedPairs.Num());
+		PairResults.Append(PrecomputedPairs.GetData(), PrecomputedPairs.Num());
+	}
+	else
+	{
+		ComputePairTable();
+	}
+
+	BuildRecipeIndex();
+}
+
+int32 FFusionEngine::FindDemon(FName DemonID) const
+{
+	const int32* Index = IndexByID.Find(DemonID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FFusionEngine::Fuse(int32 A, int32 B) const
+{
+	if (A == B || !Demons.IsValidIndex(A) || !Demons.IsValidIndex(B))
+	{
+		return INDEX_NONE;
+	}
+	return PairResults[GetPairIndex(A, B)];
+}
+
+TConstArrayView<FFusionPair> FFusionEngine::GetRecipes(int32 Result) const
+{
+	if (!Demons.IsValidIndex(Result))
+	{
+		return TConstArrayView<FFusionPair>();
+	}
+	return TConstArrayView<FFusionPair>(Recipes.GetData() + RecipeOffsets[Result], RecipeOffsets[Result + 1] - RecipeOffsets[Result]);
+}
+
+void FFusionEngine::InheritSkills(int32 A, int32 B, int32 Result, FRandomStream& Random, TArray<FName, TInlineAllocator<MaxInheritedSkills>>& OutSkills) const
+{
+	OutSkills.Reset();
+	if (!Demons.IsValidIndex(A) || !Demons.IsValidIndex(B) || !Demons.IsValidIndex(Result))
+	{
+		return;
+	}
+
+	// Skills inatas do resultado têm prioridade
+	for (const FName& Skill : Demons[Result].Skills)
+	{
+		if (OutSkills.Num() < MaxInheritedSkills)
+		{
+			OutSkills.AddUnique(Skill);
+		}
+	}
+
+	// Candidatos herdados dos pais (sem repetir)
+	TArray<FName, TInlineAllocator<16>> Pool;
+	for (const int32 Parent : { A, B })
+	{
+		for (const FName& Skill : Demons[Parent].Skills)
+		{
+			if (!OutSkills.Contains(Skill))
+			{
+				Pool.AddUnique(Skill);
+			}
+		}
+	}
+
+	// Sorteio sem reposição (Fisher-Yates parcial) com o RNG do chamador
+	for (int32 i = 0; i < Pool.Num() && OutSkills.Num() < MaxInheritedSkills; i++)
+	{
+		const int32 Pick = i + Random.RandHelper(Pool.Num() - i);
+		Pool.Swap(i, Pick);
+		OutSkills.Add(Pool[i]);
+	}
+}
+
+int32 FFusionEngine::ComputeFusion(int32 A, int32 B) const
+{
+	const uint8 ResultRace = GetResultRace(Demons[A].Race, Demons[B].Race);
+	if (ResultRace == NoRace)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 First = RaceOffsets[ResultRace];
+	const int32 Last = RaceOffsets[ResultRace + 1];
+	if (First == Last)
+	{
+		return INDEX_NONE;
+	}
+
+	// Primeiro demônio da raça com nível >= média dos pais + 1
+	const int32 TargetLevel = (Demons[A].Level + Demons[B].Level) / 2 + 1;
+	TConstArrayView<int32> Group(RaceDemons.GetData() + First, Last - First);
+	int32 Candidate = Algo::LowerBoundBy(Group, TargetLevel, [this](int32 Index) { return Demons[Index].Level; });
+
+	// Um pai nunca é o próprio resultado
+	while (Candidate < Group.Num() && (Group[Candidate] == A || Group[Candidate] == B))
+	{
+		Candidate++;
+	}
+
+	if (Candidate < Group.Num())
+	{
+		return Group[Candidate];
+	}
+
+	// Acima do teto da raça: o mais forte que não seja um dos pais
+	for (int32 i = Group.Num() - 1; i >= 0; i--)
+	{
+		if (Group[i] != A && Group[i] != B)
+		{
+			return Group[i];
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FFusionEngine::GetPairIndex(int32 A, int32 B) const
+{
+	if (A > B)
+	{
+		Swap(A, B);
+	}
+	const int32 N = Demons.Num();
+	return A * (2 * N - A - 1) / 2 + (B - A - 1);
+}
+
+void FFusionEngine::ComputePairTable()
+{
+	const int32 N = Demons.Num();
+	PairResults.SetNumUninitialized(FMath::Max(0, GetPairTableSize(N)));
+
+	// Cada linha A escreve apenas nos seus próprios pares (A, B > A)
+	ParallelFor(N, [this, N](int32 A)
+	{
+		int32 Index = GetPairIndex(A, A + 1);
+		for (int32 B = A + 1; B < N; B++)
+		{
+			PairResults[Index++] = (int16)ComputeFusion(A, B);
+		}
+	});
+}
+
+void FFusionEngine::BuildRecipeIndex()
+{
+	const int32 N = Demons.Num();
+
+	// Contar pares por resultado
+	RecipeOffsets.Init(0, N + 1);
+	for (const int16 Result : PairResults)
+	{
+		if (Result != INDEX_NONE)
+		{
+			RecipeOffsets[Result + 1]++;
+		}
+	}
+	for (int32 i = 0; i < N; i++)
+	{
+		RecipeOffsets[i + 1] += RecipeOffsets[i];
+	}
+
+	// Preencher na ordem (A, B) crescente para manter o resultado determinístico
+	Recipes.SetNumUninitialized(RecipeOffsets[N]);
+	TArray<int32> Cursor(RecipeOffsets.GetData(), N);
+
+	int32 Index = 0;
+	for (int32 A = 0; A < N; A++)
+	{
+		for (int32 B = A + 1; B < N; B++, Index++)
+		{
+			const int16 Result = PairResults[Index];
+			if (Result != INDEX_NONE)
+			{
+				FFusionPair& Pair = Recipes[Cursor[Result]++];
+				Pair.A = (uint16)A;
+				Pair.B = (uint16)B;
+			}
+		}
+	}
+}
@@ -0,0 +1,108 @@
+// FusionEngine.h
+// Motor de fusão: tabela raça x raça, resultado por nível e herança de skills
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Core/RPGTypes.h"
+
+/**
+ * Demônio na forma usada pelo motor
+ */
+struct FFusionDemon
+{
+	FName DemonID;
+	EDemonRace Race = EDemonRace::Beast;
+	int32 Level = 1;
+	TArray<FName> Skills;
+};
+
+/**
+ * Par de ingredientes (índices no compêndio de fusão)
+ */
+struct FFusionPair
+{
+	uint16 A = 0;
+	uint16 B = 0;
+};
+
+/**
+ * Motor de fusão com tabelas pré-computadas
+ * Build() resolve todos os pares (em paralelo) e monta um índice reverso em
+ * formato CSR: "quais pares produzem X?" vira uma fatia de array, sem
+ * enumerar combinações.
+ */
+class J_API FFusionEngine
+{
+public:
+	static constexpr int32 NumRaces = (int32)EDemonRace::MAX;
+	static constexpr uint8 NoRace = 0xFF;
+	static constexpr int32 MaxInheritedSkills = 8;
+
+	/**
+	 * Monta o motor. RaceChart tem NumRaces * NumRaces entradas (NoRace = sem fusão).
+	 * Se PrecomputedPairs tiver o tamanho certo (baked no cook), é usado no lugar
+	 * do cálculo dos pares.
+	 */
+	void Build(TArray<FFusionDemon>&& InDemons, TConstArrayView<uint8> InRaceChart, TConstArrayView<int16> PrecomputedPairs = TConstArrayView<int16>());
+
+	int32 Num() const { return Demons.Num(); }
+	const FFusionDemon& GetDemon(int32 Index) const { return Demons[Index]; }
+
+	/** Índice de um demônio pelo ID, ou INDEX_NONE */
+	int32 FindDemon(FName DemonID) const;
+
+	/** Raça resultante de RaceA x RaceB (NoRace = não fundem) */
+	uint8 GetResultRace(EDemonRace RaceA, EDemonRace RaceB) const
+	{
+		return RaceChart[(int32)RaceA * NumRaces + (int32)RaceB];
+	}
+
+	/** Resultado da fusão A x B via tabela pré-computada (INDEX_NONE = inválida) */
+	int32 Fuse(int32 A, int32 B) const;
+
+	/** Todos os pares que produzem Result */
+	TConstArrayView<FFusionPair> GetRecipes(int32 Result) const;
+
+	/**
+	 * Skills do resultado: as inatas primeiro, depois skills dos pais
+	 * sorteadas até MaxInheritedSkills.
+	 */
+	void InheritSkills(int32 A, int32 B, int32 Result, FRandomStream& Random, TArray<FName, TInlineAllocator<MaxInheritedSkills>>& OutSkills) const;
+
+	/** Tabela triangular de pares (para bake) */
+	const TArray<int16>& GetPairTable() const { return PairResults; }
+
+	/** Tamanho esperado da tabela de pares para N demônios */
+	static int32 GetPairTableSize(int32 NumDemons) { return NumDemons * (NumDemons - 1) / 2; }
+
+private:
+	/** Aplica a regra de fusão (raça + nível) sem consultar a tabela */
+	int32 ComputeFusion(int32 A, int32 B) const;
+
+	/** Índice na tabela triangular (A != B) */
+	int32 GetPairIndex(int32 A, int32 B) const;
+
+	/** Preenche PairResults em paralelo, uma linha por tarefa */
+	void ComputePairTable();
+
+	/** Monta o índice reverso a partir de PairResults */
+	void BuildRecipeIndex();
+
+	TArray<FFusionDemon> Demons;
+	TMap<FName, int32> IndexByID;
+
+	uint8 RaceChart[NumRaces * NumRaces] = {};
+
+	/** Demônios agrupados por raça e ordenados por nível (CSR) */
+	TArray<int32> RaceOffsets;
+	TArray<int32> RaceDemons;
+
+	/** Resultado de cada par A < B */
+	TArray<int16> PairResults;
+
+	/** Índice reverso (CSR): pares que produzem cada demônio */
+	TArray<int32> RecipeOffsets;
+	TArray<FFusionPair> Recipes;
+};
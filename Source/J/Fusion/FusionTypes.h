@@ -0,0 +1,52 @@
+// FusionTypes.h
+// Dados de autoria da fusão de demônios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RPGTypes.h"
+#include "FusionTypes.generated.h"
+
+/**
+ * Demônio disponível para fusão
+ */
+USTRUCT(BlueprintType)
+struct FFusionDemonDef
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	FName DemonID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	EDemonRace Race = EDemonRace::Beast;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion", meta = (ClampMin = "1"))
+	int32 Level = 1;
+
+	/** Skills inatas (herdáveis pelos filhos) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	TArray<FName> Skills;
+
+	/** Classe do inimigo correspondente */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	TSoftClassPtr<class AEnemyBase> DemonClass;
+};
+
+/**
+ * Regra da tabela de raças: RaceA x RaceB = Result (simétrica)
+ */
+USTRUCT(BlueprintType)
+struct FFusionRaceRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	EDemonRace RaceA = EDemonRace::Beast;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	EDemonRace RaceB = EDemonRace::Beast;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fusion")
+	EDemonRace Result = EDemonRace::Beast;
+};
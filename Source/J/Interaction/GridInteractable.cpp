@@ -0,0 +1,17 @@
+// GridInteractable.cpp
+
+#include "GridInteractable.h"
+
+bool IGridInteractable::CanInteract_Implementation(AActor* Interactor) const
+{
+	return true;
+}
+
+FText IGridInteractable::GetInteractionPrompt_Implementation() const
+{
+	return NSLOCTEXT("Interaction", "DefaultPrompt", "Examinar");
+}
+
+void IGridInteractable::Interact_Implementation(AActor* Interactor)
+{
+}
@@ -0,0 +1,37 @@
+// GridInteractable.h
+// Interface para objetos com que o jogador interage no grid
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "GridInteractable.generated.h"
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class UGridInteractable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Portas, baús, NPCs, terminais...
+ * O ator se registra no UInteractionSubsystem com a célula que ocupa; o
+ * jogador interage com o que estiver na célula à sua frente.
+ */
+class J_API IGridInteractable
+{
+	GENERATED_BODY()
+
+public:
+	/** Pode interagir agora? (ex.: baú já aberto retorna false) */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Interaction")
+	bool CanInteract(AActor* Interactor) const;
+
+	/** Texto do prompt ("Abrir", "Falar"...) */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Interaction")
+	FText GetInteractionPrompt() const;
+
+	/** Executa a interação */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Interaction")
+	void Interact(AActor* Interactor);
+};
@@ -0,0 +1,48 @@
+// InteractionSubsystem.cpp
+
+#include "InteractionSubsystem.h"
+#include "GridInteractable.h"
+#include "Core/GridTypes.h"
+
+bool UInteractionSubsystem::RegisterInteractable(AActor* Actor, FIntPoint Cell)
+{
+	if (!Actor || !Actor->Implements<UGridInteractable>())
+	{
+		return false;
+	}
+
+	UnregisterInteractable(Actor);
+
+	if (const TWeakObjectPtr<AActor>* Existing = CellToActor.Find(Cell))
+	{
+		if (Existing->IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Interaction: Célula (%d, %d) já ocupada por %s"), Cell.X, Cell.Y, *(*Existing)->GetName());
+		}
+		ActorToCell.Remove(*Existing);
+	}
+
+	CellToActor.Add(Cell, Actor);
+	ActorToCell.Add(Actor, Cell);
+	return true;
+}
+
+bool UInteractionSubsystem::RegisterInteractableAtLocation(AActor* Actor, float CellSize)
+{
+	return Actor && RegisterInteractable(Actor, FGridMath::WorldToCell(Actor->GetActorLocation(), CellSize));
+}
+
+void UInteractionSubsystem::UnregisterInteractable(AActor* Actor)
+{
+	FIntPoint Cell;
+	if (ActorToCell.RemoveAndCopyValue(Actor, Cell))
+	{
+		CellToActor.Remove(Cell);
+	}
+}
+
+AActor* UInteractionSubsystem::FindInteractableAt(FIntPoint Cell) const
+{
+	const TWeakObjectPtr<AActor>* Actor = CellToActor.Find(Cell);
+	return Actor ? Actor->Get() : nullptr;
+}
@@ -0,0 +1,43 @@
+// InteractionSubsystem.h
+// Hash espacial de interagíveis por célula do grid
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionSubsystem.generated.h"
+
+/**
+ * Registro de interagíveis por célula
+ * Consultar "o que está na célula à frente" é uma busca em hash, sem line
+ * traces nem outras queries de física, então funciona igual em testes
+ * headless.
+ */
+UCLASS()
+class J_API UInteractionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Registra (ou move) um ator que implementa IGridInteractable na célula */
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	bool RegisterInteractable(AActor* Actor, FIntPoint Cell);
+
+	/** Registra o ator na célula da sua posição atual */
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	bool RegisterInteractableAtLocation(AActor* Actor, float CellSize = 200.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	void UnregisterInteractable(AActor* Actor);
+
+	/** Interagível da célula (nullptr se vazia) */
+	UFUNCTION(BlueprintPure, Category = "Interaction")
+	AActor* FindInteractableAt(FIntPoint Cell) const;
+
+	UFUNCTION(BlueprintPure, Category = "Interaction")
+	int32 GetNumInteractables() const { return CellToActor.Num(); }
+
+private:
+	TMap<FIntPoint, TWeakObjectPtr<AActor>> CellToActor;
+	TMap<TWeakObjectPtr<AActor>, FIntPoint> ActorToCell;
+};
@@ -0,0 +1,221 @@
+// InventorySubsystem.cpp
+
+#include "InventorySubsystem.h"
+#include "Core/JGameInstance.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** ItemID + quantidade (uint16) por pilha; outras versões são rejeitadas */
+	constexpr uint32 InventorySaveVersion = 2;
+}
+
+void UInventorySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (const UJGameInstance* GameInstance = Cast<UJGameInstance>(GetGameInstance()))
+	{
+		if (!GameInstance->ItemDatabase.IsNull())
+		{
+			SetItemDatabase(GameInstance->ItemDatabase.LoadSynchronous());
+		}
+	}
+}
+
+void UInventorySubsystem::SetItemDatabase(UItemDatabaseAsset* InDatabase)
+{
+	ItemDatabase = InDatabase;
+	ItemIndices.Reset();
+	Counts.Reset();
+	SlotByItem.Reset();
+}
+
+int32 UInventorySubsystem::AddItem(FName ItemID, int32 Count)
+{
+	const int32 ItemIndex = ItemDatabase ? ItemDatabase->FindItemIndex(ItemID) : INDEX_NONE;
+	if (ItemIndex == INDEX_NONE || Count <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Inventory: Item desconhecido %s"), *ItemID.ToString());
+		return 0;
+	}
+
+	const int32 MaxStack = FMath::Clamp(ItemDatabase->Items[ItemIndex].MaxStack, 1, (int32)MAX_uint16);
+
+	int32 Slot;
+	if (const int32* ExistingSlot = SlotByItem.Find((uint16)ItemIndex))
+	{
+		Slot = *ExistingSlot;
+	}
+	else
+	{
+		Slot = ItemIndices.Add((uint16)ItemIndex);
+		Counts.Add(0);
+		SlotByItem.Add((uint16)ItemIndex, Slot);
+	}
+
+	const int32 Added = FMath::Min(Count, MaxStack - Counts[Slot]);
+	Counts[Slot] += (uint16)Added;
+	return Added;
+}
+
+bool UInventorySubsystem::RemoveItem(FName ItemID, int32 Count)
+{
+	const int32 ItemIndex = ItemDatabase ? ItemDatabase->FindItemIndex(ItemID) : INDEX_NONE;
+	const int32* SlotPtr = ItemIndex != INDEX_NONE ? SlotByItem.Find((uint16)ItemIndex) : nullptr;
+	if (!SlotPtr || Count <= 0 || Counts[*SlotPtr] < Count)
+	{
+		return false;
+	}
+
+	const int32 Slot = *SlotPtr;
+	Counts[Slot] -= (uint16)Count;
+
+	// Pilha vazia: remover por swap mantendo os arrays densos
+	if (Counts[Slot] == 0)
+	{
+		const int32 LastSlot = ItemIndices.Num() - 1;
+		SlotByItem.Remove((uint16)ItemIndex);
+
+		if (Slot != LastSlot)
+		{
+			SlotByItem[ItemIndices[LastSlot]] = Slot;
+		}
+
+		ItemIndices.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+		Counts.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	}
+	return true;
+}
+
+int32 UInventorySubsystem::GetItemCount(FName ItemID) const
+{
+	const int32 ItemIndex = ItemDatabase ? ItemDatabase->FindItemIndex(ItemID) : INDEX_NONE;
+	const int32* Slot = ItemIndex != INDEX_NONE ? SlotByItem.Find((uint16)ItemIndex) : nullptr;
+	return Slot ? Counts[*Slot] : 0;
+}
+
+bool UInventorySubsystem::GetSlot(int32 SlotIndex, FName& OutItemID, int32& OutCount) const
+{
+	if (!ItemIndices.IsValidIndex(SlotIndex) || !ItemDatabase || !ItemDatabase->Items.IsValidIndex(ItemIndices[SlotIndex]))
+	{
+		return false;
+	}
+
+	OutItemID = ItemDatabase->Items[ItemIndices[SlotIndex]].ItemID;
+	OutCount = Counts[SlotIndex];
+	return true;
+}
+
+const FItemData* UInventorySubsystem::FindItemData(FName ItemID) const
+{
+	return ItemDatabase ? ItemDatabase->GetItem(ItemDatabase->FindItemIndex(ItemID)) : nullptr;
+}
+
+// ==================== SAVE ====================
+
+void UInventorySubsystem::SaveToBytes(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Version = InventorySaveVersion;
+	int32 NumSlots = ItemIndices.Num();
+	Writer << Version;
+	Writer << NumSlots;
+
+	// IDs estáveis: a linha de um item muda quando o banco é reordenado
+	for (int32 Slot = 0; Slot < NumSlots; Slot++)
+	{
+		FName ItemID = ItemDatabase && ItemDatabase->Items.IsValidIndex(ItemIndices[Slot]) ? ItemDatabase->Items[ItemIndices[Slot]].ItemID : NAME_None;
+		uint16 Count = Counts[Slot];
+		Writer << ItemID;
+		Writer << Count;
+	}
+}
+
+bool UInventorySubsystem::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+	if (!ItemDatabase)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Inventory: Save carregado sem banco de itens"));
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Version = 0;
+	int32 NumSlots = 0;
+	Reader << Version;
+	Reader << NumSlots;
+
+	// Ao menos um nome e um uint16 por pilha
+	const int64 Remaining = Bytes.Num() - Reader.Tell();
+	if (Reader.IsError() || Version != InventorySaveVersion || NumSlots < 0 || Remaining < (int64)NumSlots * sizeof(uint16))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Inventory: Save inválido"));
+		return false;
+	}
+
+	TArray<uint16> LoadedIndices;
+	TArray<uint16> LoadedCounts;
+	LoadedIndices.SetNumUninitialized(NumSlots);
+	LoadedCounts.SetNumUninitialized(NumSlots);
+
+	for (int32 Slot = 0; Slot < NumSlots && !Reader.IsError(); Slot++)
+	{
+		FName ItemID;
+		Reader << ItemID;
+		Reader << LoadedCounts[Slot];
+
+		const int32 ItemIndex = ItemDatabase->FindItemIndex(ItemID);
+		LoadedIndices[Slot] = ItemIndex != INDEX_NONE ? (uint16)ItemIndex : MAX_uint16;
+	}
+
+	if (Reader.IsError() || !Reader.AtEnd())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Inventory: Save inválido"));
+		return false;
+	}
+
+	// Montar em arrays novos: qualquer erro deixa o inventário atual intacto
+	TArray<uint16> NewIndices;
+	TArray<uint16> NewCounts;
+	TMap<uint16, int32> NewSlotByItem;
+	NewIndices.Reserve(NumSlots);
+	NewCounts.Reserve(NumSlots);
+	NewSlotByItem.Reserve(NumSlots);
+
+	for (int32 Slot = 0; Slot < NumSlots; Slot++)
+	{
+		const uint16 ItemIndex = LoadedIndices[Slot];
+		if (LoadedCounts[Slot] == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Inventory: Save inválido (pilha %d vazia)"), Slot);
+			return false;
+		}
+
+		if (!ItemDatabase->Items.IsValidIndex(ItemIndex))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Inventory: Item do save não existe mais no banco (pilha %d)"), Slot);
+			continue;
+		}
+
+		if (NewSlotByItem.Contains(ItemIndex))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Inventory: Save inválido (pilha %d repetida)"), Slot);
+			return false;
+		}
+
+		const int32 MaxStack = FMath::Clamp(ItemDatabase->Items[ItemIndex].MaxStack, 1, (int32)MAX_uint16);
+		NewSlotByItem.Add(ItemIndex, NewIndices.Num());
+		NewIndices.Add(ItemIndex);
+		NewCounts.Add((uint16)FMath::Min((int32)LoadedCounts[Slot], MaxStack));
+	}
+
+	ItemIndices = MoveTemp(NewIndices);
+	Counts = MoveTemp(NewCounts);
+	SlotByItem = MoveTemp(NewSlotByItem);
+	return true;
+}
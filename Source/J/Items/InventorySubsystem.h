@@ -0,0 +1,81 @@
+// InventorySubsystem.h
+// Inventário do jogador em arrays densos paralelos
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ItemDatabaseAsset.h"
+#include "InventorySubsystem.generated.h"
+
+/**
+ * Inventário do jogador
+ * Cada pilha ocupa a mesma posição em ItemIndices (linha no UItemDatabaseAsset)
+ * e em Counts. Um mapa pequeno (item -> posição) deixa busca e empilhamento
+ * em O(1). O save grava o ItemID de cada pilha, não a linha, para continuar
+ * válido quando o banco de itens for reordenado.
+ */
+UCLASS()
+class J_API UInventorySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Define o banco de itens (esvazia o inventário) */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void SetItemDatabase(UItemDatabaseAsset* InDatabase);
+
+	UFUNCTION(BlueprintPure, Category = "Inventory")
+	UItemDatabaseAsset* GetItemDatabase() const { return ItemDatabase; }
+
+	// ==================== PILHAS ====================
+
+	/** Adiciona itens (limitado ao MaxStack); retorna quantos couberam */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	int32 AddItem(FName ItemID, int32 Count = 1);
+
+	/** Remove itens; falha sem alterar nada se não houver o suficiente */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	bool RemoveItem(FName ItemID, int32 Count = 1);
+
+	UFUNCTION(BlueprintPure, Category = "Inventory")
+	int32 GetItemCount(FName ItemID) const;
+
+	/** Número de pilhas distintas */
+	UFUNCTION(BlueprintPure, Category = "Inventory")
+	int32 GetNumSlots() const { return ItemIndices.Num(); }
+
+	/** Item e quantidade de uma pilha (para listas de UI) */
+	UFUNCTION(BlueprintPure, Category = "Inventory")
+	bool GetSlot(int32 SlotIndex, FName& OutItemID, int32& OutCount) const;
+
+	/** Definição de um item pelo ID */
+	const FItemData* FindItemData(FName ItemID) const;
+
+	// ==================== SAVE ====================
+
+	/** Grava o inventário (cabeçalho + ItemID e quantidade de cada pilha) */
+	void SaveToBytes(TArray<uint8>& OutBytes) const;
+
+	/**
+	 * Restaura o inventário gravado por SaveToBytes
+	 * Itens que não existem mais no banco são descartados; pilhas repetidas ou
+	 * vazias invalidam o save inteiro (e o inventário atual fica intacto).
+	 */
+	bool LoadFromBytes(const TArray<uint8>& Bytes);
+
+private:
+	/** Linha no banco de itens de cada pilha */
+	TArray<uint16> ItemIndices;
+
+	/** Quantidade de cada pilha */
+	TArray<uint16> Counts;
+
+	/** Linha do banco -> pilha */
+	TMap<uint16, int32> SlotByItem;
+
+	UPROPERTY(Transient)
+	UItemDatabaseAsset* ItemDatabase = nullptr;
+};
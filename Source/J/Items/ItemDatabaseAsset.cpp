@@ -0,0 +1,38 @@
+// ItemDatabaseAsset.cpp
+
+#include "ItemDatabaseAsset.h"
+
+int32 UItemDatabaseAsset::FindItemIndex(FName ItemID) const
+{
+	if (IndexByID.Num() != Items.Num())
+	{
+		const_cast<UItemDatabaseAsset*>(this)->RebuildIndex();
+	}
+
+	const int32* Index = IndexByID.Find(ItemID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UItemDatabaseAsset::PostLoad()
+{
+	Super::PostLoad();
+	RebuildIndex();
+}
+
+#if WITH_EDITOR
+void UItemDatabaseAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	RebuildIndex();
+}
+#endif
+
+void UItemDatabaseAsset::RebuildIndex()
+{
+	IndexByID.Reset();
+	IndexByID.Reserve(Items.Num());
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		IndexByID.Add(Items[i].ItemID, i);
+	}
+}
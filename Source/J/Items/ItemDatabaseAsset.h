@@ -0,0 +1,104 @@
+// ItemDatabaseAsset.h
+// Definição de itens como dados
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Core/RPGTypes.h"
+#include "ItemDatabaseAsset.generated.h"
+
+/**
+ * Definição de um item
+ * O efeito usa os mesmos campos de FSkillData, então itens passam pelo
+ * mesmo caminho de resolução multi-alvo das skills.
+ */
+USTRUCT(BlueprintType)
+struct FItemData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	FName ItemID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	FText DisplayName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	FText Description;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	ESkillEffectType Effect = ESkillEffectType::HealHP;
+
+	/** HP/MP recuperados, % de HP ao reviver ou poder de dano */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	int32 Power = 50;
+
+	/** Elemento (itens de dano) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	ERPGElement Element = ERPGElement::Almighty;
+
+	/** Efeito aplicado ou curado */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	EStatusEffect StatusEffect = EStatusEffect::None;
+
+	/** Afeta todo o lado alvo */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	bool bTargetsAll = false;
+
+	/** Usado na própria party (curas) ou nos inimigos */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
+	bool bTargetsAllies = true;
+
+	/** Quantidade máxima por pilha */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item", meta = (ClampMin = "1", ClampMax = "65535"))
+	int32 MaxStack = 99;
+
+	/** Converte o item para a ação equivalente de skill */
+	FSkillData ToSkillData() const
+	{
+		FSkillData Skill;
+		Skill.SkillID = ItemID;
+		Skill.DisplayName = DisplayName;
+		Skill.EffectType = Effect;
+		Skill.Element = Element;
+		Skill.BasePower = Power;
+		Skill.MPCost = 0;
+		Skill.Accuracy = 100.0f;
+		Skill.bTargetsAll = bTargetsAll;
+		Skill.bTargetsAllies = bTargetsAllies;
+		Skill.StatusEffect = StatusEffect;
+		return Skill;
+	}
+};
+
+/**
+ * Banco de itens do jogo
+ * O índice de cada linha é o ID compacto usado pelo inventário em memória;
+ * saves gravam o ItemID, que continua válido se as linhas mudarem de ordem.
+ */
+UCLASS(BlueprintType)
+class J_API UItemDatabaseAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Items")
+	TArray<FItemData> Items;
+
+	/** Linha de um item, ou INDEX_NONE */
+	int32 FindItemIndex(FName ItemID) const;
+
+	const FItemData* GetItem(int32 Index) const { return Items.IsValidIndex(Index) ? &Items[Index] : nullptr; }
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void RebuildIndex();
+
+	TMap<FName, int32> IndexByID;
+};
@@ -13,12 +13,14 @@ public class J : ModuleRules
 			"CoreUObject", 
 			"Engine", 
 			"InputCore", 
-			"EnhancedInput"
+			"EnhancedInput",
+			"UMG"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] { 
 			"Slate", 
-			"SlateCore" 
+			"SlateCore",
+			"AssetRegistry"
 		});
 		
 		// Include paths para organização de pastas
@@ -27,7 +29,14 @@ public class J : ModuleRules
 			"J/Core",
 			"J/Characters",
 			"J/Combat",
-			"J/Encounters"
+			"J/Encounters",
+			"J/Negotiation",
+			"J/Fusion",
+			"J/Compendium",
+			"J/Items",
+			"J/Dungeon",
+			"J/Commandlets",
+			"J/Interaction"
 		});
 	}
 }
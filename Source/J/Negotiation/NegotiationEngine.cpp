@@ -0,0 +1,207 @@
+// NegotiationEngine.cpp
+
+#include "NegotiationEngine.h"
+
+namespace
+{
+	constexpr int32 MinMood = -100;
+	constexpr int32 MaxMood = 100;
+
+	// Linhas: personalidade; colunas: Friendly, Flattering, Aggressive, Evasive
+	constexpr float ToneMultipliers[(int32)EDemonPersonality::MAX][(int32)ENegotiationTone::MAX] =
+	{
+		{ 1.0f, 1.5f, 0.5f, 0.5f },   // Childish
+		{ 1.5f, 1.0f, 0.5f, 1.0f },   // Upbeat
+		{ 0.5f, 0.5f, 1.0f, 1.5f },   // Gloomy
+		{ 0.5f, 0.5f, 1.5f, 0.5f },   // Irritable
+		{ 0.5f, 2.0f, 0.5f, 1.0f }    // Arrogant
+	};
+
+	constexpr int32 MoodVolatility[(int32)EDemonPersonality::MAX] = { 10, 5, 5, 15, 5 };
+}
+
+// ==================== GRAFO ====================
+
+float FNegotiationGraph::GetToneMultiplier(EDemonPersonality Personality, ENegotiationTone Tone)
+{
+	if (Personality >= EDemonPersonality::MAX || Tone >= ENegotiationTone::MAX)
+	{
+		return 1.0f;
+	}
+	return ToneMultipliers[(int32)Personality][(int32)Tone];
+}
+
+int32 FNegotiationGraph::GetMoodVolatility(EDemonPersonality Personality)
+{
+	return Personality < EDemonPersonality::MAX ? MoodVolatility[(int32)Personality] : 0;
+}
+
+void FNegotiationGraph::Bake(TConstArrayView<FNegotiationNodeDef> NodeDefs)
+{
+	Nodes.Reset(NodeDefs.Num());
+	Responses.Reset();
+
+	for (const FNegotiationNodeDef& NodeDef : NodeDefs)
+	{
+		FNegotiationBakedNode& Node = Nodes.AddDefaulted_GetRef();
+		Node.FirstResponse = (uint16)Responses.Num();
+		Node.NumResponses = (uint8)FMath::Min(NodeDef.Responses.Num(), (int32)MAX_uint8);
+		Node.Demand = NodeDef.Demand;
+		Node.DemandAmount = FMath::Max(0, NodeDef.DemandAmount);
+		Node.DemandItem = NodeDef.DemandItem;
+
+		for (int32 i = 0; i < Node.NumResponses; i++)
+		{
+			const FNegotiationResponseDef& ResponseDef = NodeDef.Responses[i];
+			FNegotiationBakedResponse& Response = Responses.AddDefaulted_GetRef();
+			Response.NextNode = NodeDefs.IsValidIndex(ResponseDef.NextNode) ? (int16)ResponseDef.NextNode : (int16)INDEX_NONE;
+			Response.Outcome = ResponseDef.Outcome;
+			Response.bPaysDemand = ResponseDef.bPaysDemand;
+
+			for (int32 Personality = 0; Personality < (int32)EDemonPersonality::MAX; Personality++)
+			{
+				const float Delta = ResponseDef.MoodDelta * GetToneMultiplier((EDemonPersonality)Personality, ResponseDef.Tone);
+				Response.MoodDelta[Personality] = (int8)FMath::Clamp(FMath::RoundToInt(Delta), MinMood, MaxMood);
+			}
+		}
+	}
+}
+
+// ==================== SESSÃO ====================
+
+void FNegotiationSession::Start(const FNegotiationGraph& InGraph, EDemonPersonality InPersonality)
+{
+	Graph = &InGraph;
+	Personality = InPersonality < EDemonPersonality::MAX ? InPersonality : EDemonPersonality::Childish;
+	NodeIndex = 0;
+	Mood = FMath::Clamp(InGraph.StartingMood, MinMood, MaxMood);
+	Steps = 0;
+	Outcome = InGraph.IsValid() && InGraph.Nodes[0].NumResponses > 0 ? ENegotiationOutcome::None : ENegotiationOutcome::Flee;
+}
+
+const FNegotiationBakedNode* FNegotiationSession::GetCurrentNode() const
+{
+	return IsActive() ? &Graph->Nodes[NodeIndex] : nullptr;
+}
+
+ENegotiationOutcome FNegotiationSession::Respond(int32 ResponseIndex, const FNegotiationContext& Context, FRandomStream& Random, FNegotiationPayment& OutPayment)
+{
+	OutPayment = FNegotiationPayment();
+
+	if (!IsActive())
+	{
+		return Outcome;
+	}
+
+	const FNegotiationBakedNode& Node = Graph->Nodes[NodeIndex];
+	if (ResponseIndex < 0 || ResponseIndex >= Node.NumResponses)
+	{
+		return ENegotiationOutcome::None;
+	}
+
+	const FNegotiationBakedResponse& Response = Graph->Responses[Node.FirstResponse + ResponseIndex];
+	int32 Delta = Response.MoodDelta[(int32)Personality];
+
+	// Prometer pagar sem ter como irrita o demônio
+	if (Response.bPaysDemand && Node.Demand != ENegotiationDemand::None)
+	{
+		const bool bCanPay = Node.Demand == ENegotiationDemand::Money
+			? Context.Money >= Node.DemandAmount
+			: Context.HeldDemandItemCount >= Node.DemandAmount;
+
+		if (bCanPay)
+		{
+			if (Node.Demand == ENegotiationDemand::Money)
+			{
+				OutPayment.Money = Node.DemandAmount;
+			}
+			else
+			{
+				OutPayment.Item = Node.DemandItem;
+				OutPayment.ItemCount = Node.DemandAmount;
+			}
+		}
+		else
+		{
+			Delta = -FMath::Abs(Delta) - 10;
+		}
+	}
+
+	const int32 Volatility = FNegotiationGraph::GetMoodVolatility(Personality);
+	Delta += Random.RandRange(-Volatility, Volatility);
+
+	Mood = FMath::Clamp(Mood + Delta, MinMood, MaxMood);
+	Steps++;
+
+	if (Mood <= Graph->AngerMoodThreshold)
+	{
+		return Finish(ENegotiationOutcome::Anger);
+	}
+
+	if (Response.NextNode == INDEX_NONE)
+	{
+		// Recrutar exige humor suficiente; senão o demônio simplesmente vai embora
+		if (Response.Outcome == ENegotiationOutcome::Recruit && Mood < Graph->RecruitMoodThreshold)
+		{
+			return Finish(ENegotiationOutcome::Flee);
+		}
+		return Finish(Response.Outcome != ENegotiationOutcome::None ? Response.Outcome : ENegotiationOutcome::Flee);
+	}
+
+	if (Steps >= Graph->MaxSteps)
+	{
+		return Finish(ENegotiationOutcome::Flee);
+	}
+
+	NodeIndex = Response.NextNode;
+
+	// Nó sem respostas encerra a conversa
+	if (Graph->Nodes[NodeIndex].NumResponses == 0)
+	{
+		return Finish(ENegotiationOutcome::Flee);
+	}
+	return ENegotiationOutcome::None;
+}
+
+ENegotiationOutcome FNegotiationSession::Finish(ENegotiationOutcome InOutcome)
+{
+	Outcome = InOutcome;
+	return Outcome;
+}
+
+// ==================== SIMULAÇÃO ====================
+
+FNegotiationSimStats RunNegotiationBatch(const FNegotiationGraph& Graph, EDemonPersonality Personality,
+	const FNegotiationContext& Context, int32 NumConversations, int32 Seed)
+{
+	FNegotiationSimStats Stats;
+	FRandomStream Random(Seed);
+
+	for (int32 Conversation = 0; Conversation < NumConversations; Conversation++)
+	{
+		FNegotiationSession Session;
+		Session.Start(Graph, Personality);
+
+		FNegotiationContext Wallet = Context;
+		while (Session.IsActive())
+		{
+			const FNegotiationBakedNode* Node = Session.GetCurrentNode();
+			if (Node->NumResponses == 0)
+			{
+				break;
+			}
+
+			FNegotiationPayment Payment;
+			Session.Respond(Random.RandHelper(Node->NumResponses), Wallet, Random, Payment);
+			Wallet.Money -= Payment.Money;
+			Wallet.HeldDemandItemCount -= Payment.ItemCount;
+		}
+
+		const ENegotiationOutcome Outcome = Session.Outcome != ENegotiationOutcome::None ? Session.Outcome : ENegotiationOutcome::Flee;
+		Stats.OutcomeCounts[(int32)Outcome]++;
+		Stats.TotalSteps += Session.Steps;
+		Stats.Conversations++;
+	}
+
+	return Stats;
+}
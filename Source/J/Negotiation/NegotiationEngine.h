@@ -0,0 +1,136 @@
+// NegotiationEngine.h
+// Grafo de negociação pré-compilado e avaliação sem alocações
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "NegotiationTypes.h"
+
+/**
+ * Resposta compilada
+ * O delta de humor já vem resolvido para cada personalidade.
+ */
+struct FNegotiationBakedResponse
+{
+	int16 NextNode = INDEX_NONE;
+	ENegotiationOutcome Outcome = ENegotiationOutcome::Flee;
+	bool bPaysDemand = false;
+	int8 MoodDelta[(int32)EDemonPersonality::MAX] = {};
+};
+
+/**
+ * Nó compilado: aponta para uma faixa contígua de FNegotiationGraph::Responses
+ */
+struct FNegotiationBakedNode
+{
+	uint16 FirstResponse = 0;
+	uint8 NumResponses = 0;
+	ENegotiationDemand Demand = ENegotiationDemand::None;
+	int32 DemandAmount = 0;
+	FName DemandItem;
+};
+
+/**
+ * Grafo de negociação em arrays planos
+ * Compilado uma vez a partir do UNegotiationGraphAsset e compartilhado por
+ * todos os inimigos que usam o asset.
+ */
+struct J_API FNegotiationGraph
+{
+	TArray<FNegotiationBakedNode> Nodes;
+	TArray<FNegotiationBakedResponse> Responses;
+
+	int32 StartingMood = 0;
+	int32 RecruitMoodThreshold = 50;
+	int32 AngerMoodThreshold = -50;
+
+	/** Limite de falas para grafos com ciclos */
+	int32 MaxSteps = 32;
+
+	bool IsValid() const { return Nodes.Num() > 0; }
+
+	/** Compila os nós de autoria (índices inválidos viram fim de conversa) */
+	void Bake(TConstArrayView<FNegotiationNodeDef> NodeDefs);
+
+	/** Multiplicador de humor de um tom para uma personalidade */
+	static float GetToneMultiplier(EDemonPersonality Personality, ENegotiationTone Tone);
+
+	/** Variação aleatória de humor por resposta (quão temperamental é a personalidade) */
+	static int32 GetMoodVolatility(EDemonPersonality Personality);
+};
+
+/**
+ * Recursos do jogador relevantes para a negociação
+ */
+struct FNegotiationContext
+{
+	/** Dinheiro disponível */
+	int32 Money = 0;
+
+	/** Quantos do item pedido no nó atual o jogador tem (ver FNegotiationSession::GetCurrentNode) */
+	int32 HeldDemandItemCount = 0;
+};
+
+/**
+ * O que foi pago em uma resposta
+ */
+struct FNegotiationPayment
+{
+	int32 Money = 0;
+	FName Item;
+	int32 ItemCount = 0;
+};
+
+/**
+ * Estado de uma conversa em andamento (POD, sem alocações)
+ */
+struct J_API FNegotiationSession
+{
+	const FNegotiationGraph* Graph = nullptr;
+	EDemonPersonality Personality = EDemonPersonality::Childish;
+	int32 NodeIndex = 0;
+	int32 Mood = 0;
+	int32 Steps = 0;
+	ENegotiationOutcome Outcome = ENegotiationOutcome::None;
+
+	/** Começa uma conversa no primeiro nó do grafo */
+	void Start(const FNegotiationGraph& InGraph, EDemonPersonality InPersonality);
+
+	/** A conversa ainda está em andamento? */
+	bool IsActive() const { return Graph && Outcome == ENegotiationOutcome::None; }
+
+	/** Nó atual (nullptr se a conversa terminou) */
+	const FNegotiationBakedNode* GetCurrentNode() const;
+
+	/**
+	 * Aplica a resposta escolhida. Retorna ENegotiationOutcome::None enquanto a
+	 * conversa continua; OutPayment recebe o que deve ser descontado do jogador.
+	 */
+	ENegotiationOutcome Respond(int32 ResponseIndex, const FNegotiationContext& Context, FRandomStream& Random, FNegotiationPayment& OutPayment);
+
+private:
+	ENegotiationOutcome Finish(ENegotiationOutcome InOutcome);
+};
+
+/**
+ * Estatísticas de um lote de conversas simuladas
+ */
+struct FNegotiationSimStats
+{
+	int32 Conversations = 0;
+	int32 OutcomeCounts[(int32)ENegotiationOutcome::Anger + 1] = {};
+	int64 TotalSteps = 0;
+
+	float GetRate(ENegotiationOutcome Outcome) const
+	{
+		return Conversations > 0 ? (float)OutcomeCounts[(int32)Outcome] / Conversations : 0.0f;
+	}
+};
+
+/**
+ * Executa conversas headless (sem UWorld/atores) escolhendo respostas ao acaso.
+ * Usado para medir taxas de recrutamento de um grafo/personalidade.
+ */
+J_API FNegotiationSimStats RunNegotiationBatch(const FNegotiationGraph& Graph, EDemonPersonality Personality,
+	const FNegotiationContext& Context, int32 NumConversations, int32 Seed);
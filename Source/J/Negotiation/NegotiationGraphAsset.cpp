@@ -0,0 +1,35 @@
+// NegotiationGraphAsset.cpp
+
+#include "NegotiationGraphAsset.h"
+
+const FNegotiationGraph& UNegotiationGraphAsset::GetBakedGraph() const
+{
+	if (!bBaked)
+	{
+		const_cast<UNegotiationGraphAsset*>(this)->BakeGraph();
+	}
+	return BakedGraph;
+}
+
+void UNegotiationGraphAsset::BakeGraph()
+{
+	BakedGraph.Bake(Nodes);
+	BakedGraph.StartingMood = StartingMood;
+	BakedGraph.RecruitMoodThreshold = RecruitMoodThreshold;
+	BakedGraph.AngerMoodThreshold = AngerMoodThreshold;
+	bBaked = true;
+}
+
+void UNegotiationGraphAsset::PostLoad()
+{
+	Super::PostLoad();
+	BakeGraph();
+}
+
+#if WITH_EDITOR
+void UNegotiationGraphAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	BakeGraph();
+}
+#endif
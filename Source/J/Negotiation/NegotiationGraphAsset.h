@@ -0,0 +1,62 @@
+// NegotiationGraphAsset.h
+// Data Asset com o diálogo de negociação de um arquétipo de demônio
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "NegotiationTypes.h"
+#include "NegotiationEngine.h"
+#include "NegotiationGraphAsset.generated.h"
+
+/**
+ * Diálogo de negociação editável
+ * A versão compilada (arrays planos) é gerada ao carregar o asset e
+ * compartilhada por todas as instâncias de AEnemyBase que o referenciam.
+ */
+UCLASS(BlueprintType)
+class J_API UNegotiationGraphAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Nós da conversa; a conversa começa no nó 0 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	TArray<FNegotiationNodeDef> Nodes;
+
+	/** Humor inicial do demônio (-100 a 100) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation", meta = (ClampMin = "-100", ClampMax = "100"))
+	int32 StartingMood = 0;
+
+	/** Humor mínimo para aceitar se juntar à party */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation", meta = (ClampMin = "-100", ClampMax = "100"))
+	int32 RecruitMoodThreshold = 50;
+
+	/** Humor em que o demônio perde a paciência */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation", meta = (ClampMin = "-100", ClampMax = "100"))
+	int32 AngerMoodThreshold = -50;
+
+	/** Dinheiro dado quando o resultado é Gift */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation|Gift")
+	int32 GiftMoney = 0;
+
+	/** Item dado quando o resultado é Gift */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation|Gift")
+	FName GiftItem;
+
+	/** Grafo compilado (compila na primeira chamada se necessário) */
+	const FNegotiationGraph& GetBakedGraph() const;
+
+	/** Recompila o grafo a partir dos nós de autoria */
+	void BakeGraph();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	FNegotiationGraph BakedGraph;
+	bool bBaked = false;
+};
@@ -0,0 +1,116 @@
+// NegotiationTypes.h
+// Tipos do sistema de negociação (Talk) estilo SMT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NegotiationTypes.generated.h"
+
+/**
+ * Personalidade do demônio (define como ele reage a cada tom de resposta)
+ */
+UENUM(BlueprintType)
+enum class EDemonPersonality : uint8
+{
+	Childish    UMETA(DisplayName = "Childish"),
+	Upbeat      UMETA(DisplayName = "Upbeat"),
+	Gloomy      UMETA(DisplayName = "Gloomy"),
+	Irritable   UMETA(DisplayName = "Irritable"),
+	Arrogant    UMETA(DisplayName = "Arrogant"),
+	MAX         UMETA(Hidden)
+};
+
+/**
+ * Tom de uma resposta do jogador
+ */
+UENUM(BlueprintType)
+enum class ENegotiationTone : uint8
+{
+	Friendly    UMETA(DisplayName = "Friendly"),
+	Flattering  UMETA(DisplayName = "Flattering"),
+	Aggressive  UMETA(DisplayName = "Aggressive"),
+	Evasive     UMETA(DisplayName = "Evasive"),
+	MAX         UMETA(Hidden)
+};
+
+/**
+ * Resultado de uma negociação
+ */
+UENUM(BlueprintType)
+enum class ENegotiationOutcome : uint8
+{
+	None        UMETA(DisplayName = "None"),      // Conversa continua
+	Recruit     UMETA(DisplayName = "Recruit"),   // Demônio se junta à party
+	Flee        UMETA(DisplayName = "Flee"),      // Demônio vai embora
+	Gift        UMETA(DisplayName = "Gift"),      // Demônio dá um presente e vai embora
+	Anger       UMETA(DisplayName = "Anger")      // Demônio fica furioso e volta a lutar
+};
+
+/**
+ * O que o demônio pede em um nó da conversa
+ */
+UENUM(BlueprintType)
+enum class ENegotiationDemand : uint8
+{
+	None        UMETA(DisplayName = "None"),
+	Money       UMETA(DisplayName = "Money"),
+	Item        UMETA(DisplayName = "Item")
+};
+
+/**
+ * Resposta do jogador (dados de autoria)
+ */
+USTRUCT(BlueprintType)
+struct FNegotiationResponseDef
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	FText Text;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	ENegotiationTone Tone = ENegotiationTone::Friendly;
+
+	/** Mudança de humor base (ajustada pela personalidade no bake) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation", meta = (ClampMin = "-100", ClampMax = "100"))
+	int32 MoodDelta = 0;
+
+	/** Esta resposta paga o que o nó pede? */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	bool bPaysDemand = false;
+
+	/** Próximo nó (-1 = fim da conversa) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	int32 NextNode = INDEX_NONE;
+
+	/** Resultado quando a conversa termina nesta resposta */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	ENegotiationOutcome Outcome = ENegotiationOutcome::Flee;
+};
+
+/**
+ * Nó da conversa (dados de autoria)
+ */
+USTRUCT(BlueprintType)
+struct FNegotiationNodeDef
+{
+	GENERATED_BODY()
+
+	/** Fala do demônio */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	FText Prompt;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	ENegotiationDemand Demand = ENegotiationDemand::None;
+
+	/** Quantidade de dinheiro ou de itens pedida */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	int32 DemandAmount = 0;
+
+	/** Item pedido (quando Demand == Item) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	FName DemandItem;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Negotiation")
+	TArray<FNegotiationResponseDef> Responses;
+};
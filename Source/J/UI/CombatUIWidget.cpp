@@ -7,9 +7,73 @@ void UCombatUIWidget::NativeOnInitialized()
 	Super::NativeOnInitialized();
 }
 
+void UCombatUIWidget::NativeDestruct()
+{
+	if (CombatManager)
+	{
+		CombatManager->GetEventBus().RemoveAll(this);
+	}
+
+	Super::NativeDestruct();
+}
+
+void UCombatUIWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	// Consolidar todas as mudanças de stats do frame em uma única atualização
+	FlushParticipantStats();
+}
+
+void UCombatUIWidget::FlushParticipantStats()
+{
+	if (CombatManager && CombatManager->HasDirtyParticipants())
+	{
+		CombatManager->ConsumeDirtyParticipants(PendingStatSnapshots);
+		if (PendingStatSnapshots.Num() > 0)
+		{
+			RefreshParticipantStats(PendingStatSnapshots);
+		}
+	}
+}
+
+void UCombatUIWidget::RefreshParticipantStats_Implementation(const TArray<FParticipantStatsSnapshot>& Snapshots)
+{
+	for (const FParticipantStatsSnapshot& Snapshot : Snapshots)
+	{
+		UpdateParticipantStats(Snapshot.Participant, Snapshot.CurrentHP, Snapshot.MaxHP, Snapshot.CurrentMP, Snapshot.MaxMP);
+	}
+}
+
 void UCombatUIWidget::InitializeCombatUI_Implementation(ACombatManager* InCombatManager)
 {
+	if (CombatManager)
+	{
+		CombatManager->GetEventBus().RemoveAll(this);
+	}
+
 	CombatManager = InCombatManager;
+
+	if (CombatManager)
+	{
+		CombatManager->GetEventBus().OnCombatEnded.AddUObject(this, &UCombatUIWidget::HandleCombatEnded);
+	}
+}
+
+void UCombatUIWidget::HandleCombatEnded(ECombatState EndState)
+{
+	// O golpe final ainda não passou pelo NativeTick; as marcas somem logo depois deste evento
+	FlushParticipantStats();
+
+	if (EndState == ECombatState::Victory)
+	{
+		const FBattleRewards& Rewards = CombatManager->LastBattleRewards;
+		ShowVictoryScreen(Rewards.Experience, Rewards.Gold);
+	}
+	else if (EndState == ECombatState::Defeat)
+	{
+		ShowDefeatScreen();
+	}
 }
 
 void UCombatUIWidget::OnActionSelected(ECombatAction Action)
@@ -21,16 +85,32 @@ void UCombatUIWidget::OnActionSelected(ECombatAction Action)
 
 	if (Action == ECombatAction::Attack)
 	{
-		// Mostrar seleção de alvo para ataques
+		// Mostrar seleção de alvo para ataques, já com a prévia de cada um
+		TargetPreviews.Reset(CombatManager->Enemies.Num());
+		for (AActor* Enemy : CombatManager->Enemies)
+		{
+			TargetPreviews.Add(GetAttackPreview(Enemy));
+		}
 		ShowTargetSelection(CombatManager->Enemies);
 	}
 	else if (Action == ECombatAction::Escape)
 	{
-		CombatManager->TryEscape();
+		// Pelo fluxo de turnos: a tentativa gasta a vez do participante ativo
+		CombatManager->ExecuteAction(ECombatAction::Escape, nullptr);
 	}
 	// TODO: Outras ações
 }
 
+FDamagePreview UCombatUIWidget::GetAttackPreview(AActor* Target) const
+{
+	if (!CombatManager || !Target)
+	{
+		return FDamagePreview();
+	}
+
+	return CombatManager->PreviewDamage(CombatManager->GetActiveParticipant(), Target, ACombatManager::MakeBasicAttack());
+}
+
 void UCombatUIWidget::OnTargetSelected(AActor* Target)
 {
 	if (!CombatManager || !Target)
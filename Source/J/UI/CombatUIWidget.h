@@ -33,14 +33,31 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "Combat UI")
 	void HideActionMenu();
 
-	/** Mostra seleção de alvo */
+	/** Mostra seleção de alvo (TargetPreviews já preenchido, na mesma ordem de Targets) */
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "Combat UI")
 	void ShowTargetSelection(const TArray<AActor*>& Targets);
 
+	/** Prévia do ataque do participante ativo contra cada alvo da última ShowTargetSelection */
+	UPROPERTY(BlueprintReadOnly, Category = "Combat UI")
+	TArray<FDamagePreview> TargetPreviews;
+
+	/** Prévia do ataque básico do participante ativo contra Target (ex.: ao passar o cursor) */
+	UFUNCTION(BlueprintCallable, Category = "Combat UI")
+	FDamagePreview GetAttackPreview(AActor* Target) const;
+
 	/** Atualiza HP/MP de um participante */
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "Combat UI")
 	void UpdateParticipantStats(AActor* Participant, int32 CurrentHP, int32 MaxHP, int32 CurrentMP, int32 MaxMP);
 
+	/**
+	 * Atualiza em lote todos os participantes cujos stats mudaram neste frame.
+	 * Chamado no máximo uma vez por frame. A implementação padrão repassa cada
+	 * snapshot para UpdateParticipantStats; sobrescreva em Blueprint para
+	 * atualizar tudo em uma única chamada.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Combat UI")
+	void RefreshParticipantStats(const TArray<FParticipantStatsSnapshot>& Snapshots);
+
 	/** Mostra resultado de ataque */
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "Combat UI")
 	void ShowAttackResult(const FAttackResult& Result, AActor* Target);
@@ -59,6 +76,8 @@ public:
 
 protected:
 	virtual void NativeOnInitialized() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual void NativeDestruct() override;
 
 	/** Chamado quando uma ação é selecionada */
 	UFUNCTION(BlueprintCallable, Category = "Combat UI")
@@ -67,4 +86,14 @@ protected:
 	/** Chamado quando um alvo é selecionado */
 	UFUNCTION(BlueprintCallable, Category = "Combat UI")
 	void OnTargetSelected(AActor* Target);
+
+private:
+	/** Envia para RefreshParticipantStats os participantes marcados desde o último flush */
+	void FlushParticipantStats();
+
+	/** Mostra a tela de vitória (com as recompensas) ou de derrota */
+	void HandleCombatEnded(ECombatState EndState);
+
+	/** Buffer reutilizado entre frames para evitar alocações no flush */
+	TArray<FParticipantStatsSnapshot> PendingStatSnapshots;
 };
@@ -0,0 +1,71 @@
+// RPGHUDWidget.cpp
+
+#include "RPGHUDWidget.h"
+#include "Combat/CombatantComponent.h"
+
+void URPGHUDWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	if (UCombatantComponent* Combatant = UCombatantComponent::FindCombatant(GetOwningPlayerPawn()))
+	{
+		ObservedCombatant = Combatant;
+		Combatant->OnStatsChanged.AddUObject(this, &URPGHUDWidget::HandleStatsChanged);
+
+		// Estado inicial
+		HandleStatsChanged(Combatant->GetOwner());
+	}
+}
+
+void URPGHUDWidget::NativeDestruct()
+{
+	if (UCombatantComponent* Combatant = ObservedCombatant.Get())
+	{
+		Combatant->OnStatsChanged.RemoveAll(this);
+	}
+	ObservedCombatant = nullptr;
+
+	Super::NativeDestruct();
+}
+
+void URPGHUDWidget::HandleStatsChanged(AActor* Participant)
+{
+	if (const UCombatantComponent* Combatant = ObservedCombatant.Get())
+	{
+		const FCharacterStats& Stats = Combatant->GetStats();
+		QueueHPUpdate(Stats.CurrentHP, Stats.MaxHP);
+		QueueMPUpdate(Stats.CurrentMP, Stats.MaxMP);
+	}
+}
+
+void URPGHUDWidget::QueueHPUpdate(int32 Current, int32 Max)
+{
+	bHPDirty |= (Current != PendingHP || Max != PendingMaxHP);
+	PendingHP = Current;
+	PendingMaxHP = Max;
+}
+
+void URPGHUDWidget::QueueMPUpdate(int32 Current, int32 Max)
+{
+	bMPDirty |= (Current != PendingMP || Max != PendingMaxMP);
+	PendingMP = Current;
+	PendingMaxMP = Max;
+}
+
+void URPGHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	// Flush único por frame
+	if (bHPDirty)
+	{
+		bHPDirty = false;
+		UpdateHP(PendingHP, PendingMaxHP);
+	}
+
+	if (bMPDirty)
+	{
+		bMPDirty = false;
+		UpdateMP(PendingMP, PendingMaxMP);
+	}
+}
@@ -7,9 +7,12 @@
 #include "Blueprint/UserWidget.h"
 #include "RPGHUDWidget.generated.h"
 
+class UCombatantComponent;
+
 /**
  * Widget base para HUD do RPG
- * Mostra HP, MP, e informações básicas
+ * Mostra HP, MP, e informações básicas. Escuta OnStatsChanged do combatente
+ * do pawn dono, então HP/MP chegam sozinhos (no máximo um update por frame).
  */
 UCLASS(Abstract, Blueprintable)
 class J_API URPGHUDWidget : public UUserWidget
@@ -32,4 +35,34 @@ public:
 	/** Mostra/esconde indicador de encontro */
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "HUD")
 	void ShowEncounterWarning(bool bShow);
+
+	/**
+	 * Agenda atualização de HP/MP. Várias chamadas no mesmo frame resultam
+	 * em uma única chamada de UpdateHP/UpdateMP, e só se o valor mudou.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "HUD")
+	void QueueHPUpdate(int32 Current, int32 Max);
+
+	UFUNCTION(BlueprintCallable, Category = "HUD")
+	void QueueMPUpdate(int32 Current, int32 Max);
+
+protected:
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+private:
+	/** Agenda HP/MP com os stats atuais do combatente observado */
+	void HandleStatsChanged(AActor* Participant);
+
+	/** Combatente do pawn dono (inscrito em OnStatsChanged) */
+	TWeakObjectPtr<UCombatantComponent> ObservedCombatant;
+
+	// Últimos valores agendados e flags de "sujo"
+	int32 PendingHP = INDEX_NONE;
+	int32 PendingMaxHP = INDEX_NONE;
+	int32 PendingMP = INDEX_NONE;
+	int32 PendingMaxMP = INDEX_NONE;
+	bool bHPDirty = false;
+	bool bMPDirty = false;
 };